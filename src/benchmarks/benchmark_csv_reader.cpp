@@ -0,0 +1,67 @@
+/*
+bazelisk run --config=cpp20 -c opt //src/benchmarks:benchmark_csv_reader
+*/
+#include <benchmark/benchmark.h>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/csv_reader.h"
+#include "ypz/strong_type/signature.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <string>
+
+namespace cpu
+{
+namespace
+{
+struct LengthTag
+{};
+
+struct TimeTag
+{};
+
+using Km = CompoundUnit<double, UnitSignature<std::kilo, 1, LengthTag>>;
+using Hour = CompoundUnit<double, UnitSignature<std::ratio<3600>, 1, TimeTag>>;
+using Second = CompoundUnit<double, UnitSignature<std::ratio<1>, 1, TimeTag>>;
+using MeterPerSecond = CompoundUnit<double, UnitSignature<std::ratio<1>, 1, LengthTag>,
+                                    UnitSignature<std::ratio<1>, -1, TimeTag>>;
+
+constexpr std::size_t kRows{1 << 21};
+
+const std::string& sensorCsv()
+{
+    static const std::string text{[] {
+        std::string ret{"time[s],sensor,speed[km/h]\n"};
+        for (std::size_t i{0}; i < kRows; ++i)
+        {
+            ret += std::to_string(i) + ".25,7," + std::to_string(i % 200) + ".5\n";
+        }
+        return ret;
+    }()};
+    return text;
+}
+
+void BM_ReadCsv(benchmark::State& state)
+{
+    const std::array<FormulaInput, 3> symbols{FormulaInput{"km", DynamicUnit::of<Km>()},
+                                              FormulaInput{"h", DynamicUnit::of<Hour>()},
+                                              FormulaInput{"s", DynamicUnit::of<Second>()}};
+    const std::string& text{sensorCsv()};
+    UnitArray<Second> time{};
+    UnitArray<MeterPerSecond> speed{};
+
+    for (auto _ : state)
+    {
+        const auto rows = readCsv(text, symbols, static_cast<std::size_t>(state.range(0)),
+                                  csvColumn("time", time), csvColumn("speed", speed));
+        benchmark::DoNotOptimize(rows);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+BENCHMARK(BM_ReadCsv)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+} // namespace
+} // namespace cpu
@@ -0,0 +1,144 @@
+/*
+bazelisk run --config=cpp20 -c opt //src/benchmarks:benchmark_formula
+*/
+#include <benchmark/benchmark.h>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/formula.h"
+#include "ypz/strong_type/signature.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ratio>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace cpu
+{
+namespace
+{
+struct LengthTag
+{};
+
+struct TimeTag
+{};
+
+using Km = CompoundUnit<double, UnitSignature<std::kilo, 1, LengthTag>>;
+using Meter = CompoundUnit<double, UnitSignature<std::ratio<1>, 1, LengthTag>>;
+using Minute = CompoundUnit<double, UnitSignature<std::ratio<60>, 1, TimeTag>>;
+using KmPerHour = CompoundUnit<double, UnitSignature<std::kilo, 1, LengthTag>,
+                               UnitSignature<std::ratio<3600>, -1, TimeTag>>;
+
+constexpr std::size_t kSamples{1 << 16};
+
+/// The baseline: an AST over double, interpreted per sample.
+struct Node
+{
+    char op;
+    std::size_t input;
+    double value;
+    std::unique_ptr<Node> lhs;
+    std::unique_ptr<Node> rhs;
+};
+
+std::unique_ptr<Node> leaf(const std::size_t input)
+{
+    return std::make_unique<Node>(Node{'i', input, 0.0, nullptr, nullptr});
+}
+
+std::unique_ptr<Node> constant(const double value)
+{
+    return std::make_unique<Node>(Node{'c', 0, value, nullptr, nullptr});
+}
+
+std::unique_ptr<Node> binary(const char op, std::unique_ptr<Node> lhs, std::unique_ptr<Node> rhs)
+{
+    return std::make_unique<Node>(Node{op, 0, 0.0, std::move(lhs), std::move(rhs)});
+}
+
+double walk(const Node& node, const std::array<const double*, 3>& row)
+{
+    switch (node.op)
+    {
+    case 'i':
+        return *row[node.input];
+    case 'c':
+        return node.value;
+    case '+':
+        return walk(*node.lhs, row) + walk(*node.rhs, row);
+    case '-':
+        return walk(*node.lhs, row) - walk(*node.rhs, row);
+    case '*':
+        return walk(*node.lhs, row) * walk(*node.rhs, row);
+    default:
+        return walk(*node.lhs, row) / walk(*node.rhs, row);
+    }
+}
+
+struct Columns
+{
+    Columns() : distance(kSamples), offset(kSamples), duration(kSamples), out(kSamples)
+    {
+        for (std::size_t i{0}; i < kSamples; ++i)
+        {
+            distance[i] = static_cast<double>(i % 1000) * 0.1;
+            offset[i] = static_cast<double>(i % 7);
+            duration[i] = static_cast<double>(i % 50 + 1);
+        }
+    }
+
+    std::vector<double> distance; // Km.
+    std::vector<double> offset;   // Meter.
+    std::vector<double> duration; // Minute.
+    std::vector<double> out;      // KmPerHour.
+};
+
+/// (distance + offset) / duration, in KmPerHour, with the unit conversions written by hand.
+void BM_TreeWalking(benchmark::State& state)
+{
+    Columns columns{};
+    const std::unique_ptr<Node> tree{binary(
+        '*',
+        binary('/', binary('+', binary('*', leaf(0), constant(1000.0)), leaf(1)),
+               binary('*', leaf(2), constant(60.0))),
+        constant(3.6))};
+
+    for (auto _ : state)
+    {
+        for (std::size_t i{0}; i < kSamples; ++i)
+        {
+            columns.out[i] =
+                walk(*tree, {&columns.distance[i], &columns.offset[i], &columns.duration[i]});
+        }
+        benchmark::DoNotOptimize(columns.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kSamples));
+}
+
+void BM_Bytecode(benchmark::State& state)
+{
+    Columns columns{};
+    const std::array<FormulaInput, 3> inputs{FormulaInput{"distance", DynamicUnit::of<Km>()},
+                                             FormulaInput{"offset", DynamicUnit::of<Meter>()},
+                                             FormulaInput{"duration", DynamicUnit::of<Minute>()}};
+    const std::optional<Formula> formula{Formula::compile("(distance + offset) / duration", inputs,
+                                                          DynamicUnit::of<KmPerHour>())};
+    const std::array<std::span<const double>, 3> spans{columns.distance, columns.offset,
+                                                       columns.duration};
+
+    for (auto _ : state)
+    {
+        formula->evaluate(spans, columns.out);
+        benchmark::DoNotOptimize(columns.out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kSamples));
+}
+
+BENCHMARK(BM_TreeWalking);
+BENCHMARK(BM_Bytecode);
+} // namespace
+} // namespace cpu
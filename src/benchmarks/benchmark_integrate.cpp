@@ -0,0 +1,133 @@
+/*
+bazelisk run --config=cpp20 -c opt //src/benchmarks:benchmark_integrate
+*/
+#include <benchmark/benchmark.h>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/integrate.h"
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <span>
+#include <vector>
+
+namespace cpu
+{
+namespace
+{
+struct LengthTag
+{};
+
+struct TimeTag
+{};
+
+using Km = CompoundUnit<double, UnitSignature<std::kilo, 1, LengthTag>>;
+using Meter = CompoundUnit<double, UnitSignature<std::ratio<1>, 1, LengthTag>>;
+using MilliSecond = CompoundUnit<double, UnitSignature<std::milli, 1, TimeTag>>;
+using MeterPerSecond = CompoundUnit<double, UnitSignature<std::ratio<1>, 1, LengthTag>,
+                                    UnitSignature<std::ratio<1>, -1, TimeTag>>;
+
+constexpr std::size_t kBodies{1 << 20};
+constexpr double kDt{0.5}; // In ms.
+
+/// The positions in Km and the velocities in m/s, with the conversions written by hand.
+struct RawBodies
+{
+    RawBodies() : x(kBodies), v(kBodies)
+    {
+        for (std::size_t i{0}; i < kBodies; ++i)
+        {
+            x[i] = static_cast<double>(i % 1000);
+            v[i] = static_cast<double>(i % 17) - 8.0;
+        }
+    }
+
+    std::vector<double> x;
+    std::vector<double> v;
+};
+
+struct Bodies
+{
+    Bodies() : x(kBodies, Km{0.0}), v(kBodies, MeterPerSecond{0.0})
+    {
+        for (std::size_t i{0}; i < kBodies; ++i)
+        {
+            x[i] = Km{static_cast<double>(i % 1000)};
+            v[i] = MeterPerSecond{static_cast<double>(i % 17) - 8.0};
+        }
+    }
+
+    std::vector<Km> x;
+    std::vector<MeterPerSecond> v;
+};
+
+void BM_EulerRaw(benchmark::State& state)
+{
+    RawBodies bodies{};
+    for (auto _ : state)
+    {
+        // m/s * ms = 1e-3 m = 1e-6 km.
+        const double h{kDt * 1e-6};
+        for (std::size_t i{0}; i < kBodies; ++i)
+        {
+            bodies.x[i] += h * bodies.v[i];
+        }
+        benchmark::DoNotOptimize(bodies.x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kBodies));
+}
+
+void BM_EulerUnit(benchmark::State& state)
+{
+    Bodies bodies{};
+    for (auto _ : state)
+    {
+        eulerStep(std::span{bodies.x}, std::span{bodies.v}, MilliSecond{kDt});
+        benchmark::DoNotOptimize(bodies.x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kBodies));
+}
+
+void BM_Rk4Raw(benchmark::State& state)
+{
+    RawBodies bodies{};
+    for (auto _ : state)
+    {
+        // x' = -x / (2 s), in km per ms.
+        const double h{kDt};
+        for (std::size_t i{0}; i < kBodies; ++i)
+        {
+            const double x0{bodies.x[i]};
+            const double k1{-x0 * 5e-4};
+            const double k2{-(x0 + h / 2 * k1) * 5e-4};
+            const double k3{-(x0 + h / 2 * k2) * 5e-4};
+            const double k4{-(x0 + h * k3) * 5e-4};
+            bodies.x[i] = x0 + h / 6 * (k1 + 2 * k2 + 2 * k3 + k4);
+        }
+        benchmark::DoNotOptimize(bodies.x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kBodies));
+}
+
+void BM_Rk4Unit(benchmark::State& state)
+{
+    Bodies bodies{};
+    const auto decay = [](const Km x) { return MeterPerSecond{-x.count() * 500.0}; };
+    for (auto _ : state)
+    {
+        rk4Step(std::span{bodies.x}, MilliSecond{kDt}, decay);
+        benchmark::DoNotOptimize(bodies.x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kBodies));
+}
+
+BENCHMARK(BM_EulerRaw);
+BENCHMARK(BM_EulerUnit);
+BENCHMARK(BM_Rk4Raw);
+BENCHMARK(BM_Rk4Unit);
+} // namespace
+} // namespace cpu
@@ -0,0 +1,72 @@
+/*
+bazelisk run --config=cpp20 -c opt //src/benchmarks:benchmark_sharded_counter
+*/
+#include <benchmark/benchmark.h>
+
+#include "ypz/strong_type/atomic_unit.h"
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/sharded_counter.h"
+#include "ypz/strong_type/signature.h"
+#include <atomic>
+#include <cstdint>
+#include <ratio>
+
+namespace cpu
+{
+namespace
+{
+struct TimeTag
+{};
+
+using NanoSecond = CompoundUnit<std::int64_t, UnitSignature<std::nano, 1, TimeTag>>;
+using MicroSecond = CompoundUnit<std::int64_t, UnitSignature<std::micro, 1, TimeTag>>;
+
+std::atomic<std::int64_t> raw_atomic{0};
+AtomicUnit<NanoSecond> atomic_unit{};
+ShardedCounter<NanoSecond> sharded_counter{};
+
+void BM_StdAtomic(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        raw_atomic.fetch_add(1000, std::memory_order_relaxed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_AtomicUnit(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        atomic_unit.fetch_add(MicroSecond{1}, std::memory_order_relaxed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ShardedCounter(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        sharded_counter.add(MicroSecond{1});
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0)
+    {
+        benchmark::DoNotOptimize(sharded_counter.snapshot());
+    }
+}
+
+void BM_ShardedCounterSnapshot(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sharded_counter.snapshot());
+    }
+}
+} // namespace
+
+BENCHMARK(BM_StdAtomic)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_AtomicUnit)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_ShardedCounter)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_ShardedCounterSnapshot);
+} // namespace cpu
@@ -0,0 +1,117 @@
+/*
+bazelisk run --config=cpp20 -c opt //src/benchmarks:benchmark_stream_codec
+*/
+#include <benchmark/benchmark.h>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/stream_codec.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <span>
+#include <vector>
+
+namespace cpu
+{
+namespace
+{
+struct TimeTag
+{};
+
+struct LengthTag
+{};
+
+using NanoSecond = CompoundUnit<std::int64_t, UnitSignature<std::nano, 1, TimeTag>>;
+using Meter = CompoundUnit<double, UnitSignature<std::ratio<1>, 1, LengthTag>>;
+
+constexpr std::size_t kValues{1 << 20};
+constexpr std::size_t kChunk{4096};
+
+/// Timestamps with a jitter of `spread` ns around a step of 1 ms, i.e. deltas of 3 bytes.
+std::vector<NanoSecond> timestamps(const std::int64_t spread)
+{
+    std::vector<NanoSecond> values{};
+    values.reserve(kValues);
+    std::uint64_t state{0x9E37'79B9'7F4A'7C15ULL};
+    std::int64_t time{0};
+    for (std::size_t i{0}; i < kValues; ++i)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        time += 1'000'000 + static_cast<std::int64_t>(state >> 33) % spread;
+        values.push_back(NanoSecond{time});
+    }
+    return values;
+}
+
+/// Small deltas, one byte each.
+std::vector<NanoSecond> counters()
+{
+    std::vector<NanoSecond> values{};
+    values.reserve(kValues);
+    for (std::size_t i{0}; i < kValues; ++i)
+    {
+        values.push_back(NanoSecond{static_cast<std::int64_t>(i + i % 7)});
+    }
+    return values;
+}
+
+/// A slowly varying signal, sampled in float.
+std::vector<Meter> positions()
+{
+    std::vector<Meter> values{};
+    values.reserve(kValues);
+    for (std::size_t i{0}; i < kValues; ++i)
+    {
+        values.push_back(Meter{std::round(1000.0 * std::sin(static_cast<double>(i) * 1e-3)) / 8});
+    }
+    return values;
+}
+
+template <class CU>
+void decodeAll(benchmark::State& state, const std::vector<CU>& values)
+{
+    const std::vector<std::uint8_t> bytes{encodeStream(std::span<const CU>{values})};
+    std::vector<typename CU::Rep> out(kChunk);
+    for (auto _ : state)
+    {
+        StreamDecoder<CU> decoder{bytes};
+        while (!decoder.done())
+        {
+            benchmark::DoNotOptimize(decoder.decode(out));
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(values.size()));
+    // Throughput of the decoded counts.
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(values.size() * sizeof(typename CU::Rep)));
+    state.counters["encoded_bytes_per_value"] =
+        static_cast<double>(bytes.size()) / static_cast<double>(values.size());
+}
+
+void BM_DecodeSmallDeltas(benchmark::State& state) { decodeAll(state, counters()); }
+
+void BM_DecodeTimestamps(benchmark::State& state) { decodeAll(state, timestamps(1'000'000)); }
+
+void BM_DecodeXorDouble(benchmark::State& state) { decodeAll(state, positions()); }
+
+void BM_Encode(benchmark::State& state)
+{
+    const std::vector<NanoSecond> values{timestamps(1'000'000)};
+    for (auto _ : state)
+    {
+        std::vector<std::uint8_t> bytes{encodeStream(std::span<const NanoSecond>{values})};
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(values.size()));
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<std::int64_t>(values.size() * sizeof(std::int64_t)));
+}
+
+BENCHMARK(BM_DecodeSmallDeltas);
+BENCHMARK(BM_DecodeTimestamps);
+BENCHMARK(BM_DecodeXorDouble);
+BENCHMARK(BM_Encode);
+} // namespace
+} // namespace cpu
@@ -0,0 +1,165 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_ATOMIC_UNIT_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_ATOMIC_UNIT_H_
+
+#include <atomic>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#include "ypz/strong_type/compound_unit.h"
+
+namespace cpu
+{
+/// Concept for a compound unit whose Rep supports atomic arithmetic.
+template <class CU>
+concept AtomicCompatibleUnitConcept =
+    CompoundUnitConcept<CU> &&
+    (std::integral<typename CU::Rep> || std::floating_point<typename CU::Rep>);
+
+namespace atomic_unit_helper
+{
+/**
+ * Atomic operations on the count of a compound unit.
+ * @details The operands are converted to CU before the atomic operation, the conversion only
+ *          involves compile time constants. The operations on the underlying atomic are the
+ *          same as on a plain std::atomic<Rep>.
+ * @tparam CU the compound unit.
+ * @tparam Atomic std::atomic<Rep> or std::atomic_ref<Rep>.
+ */
+template <AtomicCompatibleUnitConcept CU, class Atomic>
+class AtomicUnitBase
+{
+  public:
+    using Unit = CU;
+    using Rep = typename CU::Rep;
+
+    static constexpr bool is_always_lock_free{Atomic::is_always_lock_free};
+
+    bool is_lock_free() const { return atomic_.is_lock_free(); }
+
+    /// @brief Atomically load the value.
+    CU load(const std::memory_order order = std::memory_order_seq_cst) const
+    {
+        return CU{atomic_.load(order)};
+    }
+
+    /// @brief Atomically store a castable compound unit.
+    template <CompoundUnitConcept X>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, X>)
+    void store(const X& desired, const std::memory_order order = std::memory_order_seq_cst)
+    {
+        atomic_.store(CU{desired}.count(), order);
+    }
+
+    /// @brief Atomically replace the value, return the previous value.
+    template <CompoundUnitConcept X>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, X>)
+    CU exchange(const X& desired, const std::memory_order order = std::memory_order_seq_cst)
+    {
+        return CU{atomic_.exchange(CU{desired}.count(), order)};
+    }
+
+    /// @brief Atomically add a castable compound unit, return the previous value.
+    template <CompoundUnitConcept X>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, X>)
+    CU fetch_add(const X& delta, const std::memory_order order = std::memory_order_seq_cst)
+    {
+        return CU{atomic_.fetch_add(CU{delta}.count(), order)};
+    }
+
+    /// @brief Atomically subtract a castable compound unit, return the previous value.
+    template <CompoundUnitConcept X>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, X>)
+    CU fetch_sub(const X& delta, const std::memory_order order = std::memory_order_seq_cst)
+    {
+        return CU{atomic_.fetch_sub(CU{delta}.count(), order)};
+    }
+
+    /**
+     * Atomically compare the value with `expected` and replace it by `desired` if equal.
+     * @details Otherwise `expected` is updated with the current value.
+     * @return whether the value has been replaced.
+     */
+    ///@{
+    template <CompoundUnitConcept X>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, X>)
+    bool compare_exchange_weak(CU& expected, const X& desired,
+                               const std::memory_order order = std::memory_order_seq_cst)
+    {
+        Rep expected_count{expected.count()};
+        const bool exchanged{
+            atomic_.compare_exchange_weak(expected_count, CU{desired}.count(), order)};
+        expected = CU{expected_count};
+        return exchanged;
+    }
+
+    template <CompoundUnitConcept X>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, X>)
+    bool compare_exchange_strong(CU& expected, const X& desired,
+                                 const std::memory_order order = std::memory_order_seq_cst)
+    {
+        Rep expected_count{expected.count()};
+        const bool exchanged{
+            atomic_.compare_exchange_strong(expected_count, CU{desired}.count(), order)};
+        expected = CU{expected_count};
+        return exchanged;
+    }
+    ///@}
+
+  protected:
+    template <class... Args>
+    explicit AtomicUnitBase(Args&&... args) : atomic_{std::forward<Args>(args)...}
+    {}
+
+    Atomic atomic_;
+};
+} // namespace atomic_unit_helper
+
+/**
+ * Atomic compound unit, e.g. a counter of bytes or of latency updated from many threads.
+ * @details AtomicUnit<CU> has the same size and lock-freedom as std::atomic<CU::Rep>.
+ */
+template <AtomicCompatibleUnitConcept CU>
+class AtomicUnit : public atomic_unit_helper::AtomicUnitBase<CU, std::atomic<typename CU::Rep>>
+{
+    using Base = atomic_unit_helper::AtomicUnitBase<CU, std::atomic<typename CU::Rep>>;
+
+  public:
+    /// @brief Default constructor, the value is zero.
+    AtomicUnit() : Base{typename CU::Rep{0}} {}
+
+    /// @brief Construct from a castable compound unit.
+    template <CompoundUnitConcept X>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, X>)
+    explicit AtomicUnit(const X& desired) : Base{CU{desired}.count()}
+    {}
+
+    AtomicUnit(const AtomicUnit&) = delete;
+    AtomicUnit& operator=(const AtomicUnit&) = delete;
+};
+
+/**
+ * Atomic view of a compound unit which is not atomic by itself, in the manner of
+ * std::atomic_ref, e.g. of an element of an array of compound units.
+ * @pre While any AtomicUnitRef to an object exists, the object must only be accessed through
+ *      AtomicUnitRef.
+ */
+template <AtomicCompatibleUnitConcept CU>
+class AtomicUnitRef
+    : public atomic_unit_helper::AtomicUnitBase<CU, std::atomic_ref<typename CU::Rep>>
+{
+    using Base = atomic_unit_helper::AtomicUnitBase<CU, std::atomic_ref<typename CU::Rep>>;
+
+    static_assert(std::is_standard_layout_v<CU> && sizeof(CU) == sizeof(typename CU::Rep),
+                  "The count shall be the only member of the compound unit.");
+    static_assert(alignof(CU) >= std::atomic_ref<typename CU::Rep>::required_alignment,
+                  "The compound unit shall be aligned for atomic access.");
+
+  public:
+    /// @brief Construct a view of `value`.
+    explicit AtomicUnitRef(CU& value) : Base{reinterpret_cast<typename CU::Rep&>(value)} {}
+};
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_ATOMIC_UNIT_H_
@@ -0,0 +1,389 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_BOUNDED_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_BOUNDED_H_
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/number.h"
+#include "ypz/strong_type/helpers/type.h"
+#include "ypz/strong_type/signature.h"
+
+namespace cpu
+{
+namespace bounded_helper
+{
+/// The narrowest integer type which holds every value of [Lo, Hi], unsigned if Lo >= 0.
+template <std::intmax_t Lo, std::intmax_t Hi>
+using narrowest_t = std::conditional_t<
+    (Lo >= 0),
+    std::conditional_t<
+        (Hi <= std::numeric_limits<std::uint8_t>::max()), std::uint8_t,
+        std::conditional_t<(Hi <= std::numeric_limits<std::uint16_t>::max()), std::uint16_t,
+                           std::conditional_t<(Hi <= std::numeric_limits<std::uint32_t>::max()),
+                                              std::uint32_t, std::uint64_t>>>,
+    std::conditional_t<
+        (Lo >= std::numeric_limits<std::int8_t>::min() &&
+         Hi <= std::numeric_limits<std::int8_t>::max()),
+        std::int8_t,
+        std::conditional_t<(Lo >= std::numeric_limits<std::int16_t>::min() &&
+                            Hi <= std::numeric_limits<std::int16_t>::max()),
+                           std::int16_t,
+                           std::conditional_t<(Lo >= std::numeric_limits<std::int32_t>::min() &&
+                                               Hi <= std::numeric_limits<std::int32_t>::max()),
+                                              std::int32_t, std::int64_t>>>>;
+
+/**
+ * Closed interval of integers, for the compile time range analysis.
+ * @details Every operation returns std::nullopt if an end point overflows std::intmax_t.
+ */
+struct Interval
+{
+    std::intmax_t lo;
+    std::intmax_t hi;
+
+    /// Whether every value of the interval is representable in Rep.
+    template <std::signed_integral Rep>
+    constexpr bool fits() const
+    {
+        return lo >= std::numeric_limits<Rep>::min() && hi <= std::numeric_limits<Rep>::max();
+    }
+};
+
+constexpr std::optional<std::intmax_t> checkedMultiply(const std::intmax_t a, const std::intmax_t b)
+{
+    constexpr std::intmax_t kMax{std::numeric_limits<std::intmax_t>::max()};
+    constexpr std::intmax_t kMin{std::numeric_limits<std::intmax_t>::min()};
+    const bool overflow{a > 0 ? (b > 0 ? a > kMax / b : b < kMin / a)
+                              : (b > 0 ? a < kMin / b : (a != 0 && b < kMax / a))};
+    if (overflow)
+    {
+        return std::nullopt;
+    }
+    return a * b;
+}
+
+constexpr std::optional<std::intmax_t> checkedAdd(const std::intmax_t a, const std::intmax_t b)
+{
+    constexpr std::intmax_t kMax{std::numeric_limits<std::intmax_t>::max()};
+    constexpr std::intmax_t kMin{std::numeric_limits<std::intmax_t>::min()};
+    if ((b > 0 && a > kMax - b) || (b < 0 && a < kMin - b))
+    {
+        return std::nullopt;
+    }
+    return a + b;
+}
+
+constexpr std::optional<Interval> add(const std::optional<Interval> a,
+                                      const std::optional<Interval> b)
+{
+    if (!a || !b)
+    {
+        return std::nullopt;
+    }
+    const std::optional<std::intmax_t> lo{checkedAdd(a->lo, b->lo)};
+    const std::optional<std::intmax_t> hi{checkedAdd(a->hi, b->hi)};
+    if (!lo || !hi)
+    {
+        return std::nullopt;
+    }
+    return Interval{*lo, *hi};
+}
+
+constexpr std::optional<Interval> negate(const std::optional<Interval> a)
+{
+    if (!a || a->lo == std::numeric_limits<std::intmax_t>::min())
+    {
+        return std::nullopt;
+    }
+    return Interval{-a->hi, -a->lo};
+}
+
+constexpr std::optional<Interval> multiply(const std::optional<Interval> a,
+                                           const std::optional<Interval> b)
+{
+    if (!a || !b)
+    {
+        return std::nullopt;
+    }
+    const std::optional<std::intmax_t> products[]{
+        checkedMultiply(a->lo, b->lo), checkedMultiply(a->lo, b->hi),
+        checkedMultiply(a->hi, b->lo), checkedMultiply(a->hi, b->hi)};
+    Interval ret{std::numeric_limits<std::intmax_t>::max(),
+                 std::numeric_limits<std::intmax_t>::min()};
+    for (const std::optional<std::intmax_t>& product : products)
+    {
+        if (!product)
+        {
+            return std::nullopt;
+        }
+        ret.lo = std::min(ret.lo, *product);
+        ret.hi = std::max(ret.hi, *product);
+    }
+    return ret;
+}
+
+/// Division by a positive constant truncates towards zero, which is monotonic.
+constexpr std::optional<Interval> divide(const std::optional<Interval> a, const std::intmax_t den)
+{
+    if (!a)
+    {
+        return std::nullopt;
+    }
+    return Interval{a->lo / den, a->hi / den};
+}
+} // namespace bounded_helper
+
+/**
+ * Integer rep whose values are known to lie in [Lo, Hi].
+ * @details The value is stored in the narrowest integer type which holds [Lo, Hi], e.g.
+ *          Bounded<std::int64_t, 0, 200> is stored in one byte.
+ *          When both operands of +, - or * are compound units of Bounded reps, the range of the
+ *          result is computed at compile time by interval arithmetic, including the scaling of
+ *          the periods, so the result is again a Bounded rep, stored in the narrowest type
+ *          which holds it. An operation whose intermediate values may overflow Rep fails to
+ *          compile. Any other operation (division, or mixed with another rep) is carried out in
+ *          Rep.
+ *          The bounds are enforced lazily: only a value constructed from outside of the analysis
+ *          is clamped into [Lo, Hi].
+ * @tparam Rep the signed integer type of the computation.
+ * @tparam Lo the lowest value.
+ * @tparam Hi the highest value.
+ */
+template <std::signed_integral Rep, Rep Lo, Rep Hi>
+requires(Lo <= Hi)
+class Bounded
+{
+  public:
+    /// @brief The type of the storage.
+    using storage_type = bounded_helper::narrowest_t<Lo, Hi>;
+
+    /// @brief The range of the values.
+    static constexpr bounded_helper::Interval kRange{Lo, Hi};
+
+    /// @brief Construct the value in [Lo, Hi] closest to zero.
+    constexpr Bounded() : value_{static_cast<storage_type>(std::clamp<Rep>(0, Lo, Hi))} {}
+
+    /// @brief Construct from a value, which is clamped into [Lo, Hi].
+    explicit constexpr Bounded(const Rep value)
+        : value_{static_cast<storage_type>(std::clamp(value, Lo, Hi))}
+    {}
+
+    /// @brief Construct from a value which is known to lie in [Lo, Hi], without clamping.
+    static constexpr Bounded unchecked(const Rep value)
+    {
+        Bounded ret{};
+        ret.value_ = static_cast<storage_type>(value);
+        return ret;
+    }
+
+    /// @brief Get the value.
+    constexpr Rep value() const { return static_cast<Rep>(value_); }
+
+    friend constexpr bool operator==(const Bounded lhs, const Bounded rhs)
+    {
+        return lhs.value_ == rhs.value_;
+    }
+
+    friend constexpr std::strong_ordering operator<=>(const Bounded lhs, const Bounded rhs)
+    {
+        return lhs.value() <=> rhs.value();
+    }
+
+  private:
+    storage_type value_;
+};
+
+template <class T>
+struct is_bounded : std::false_type
+{};
+
+template <std::signed_integral Rep, Rep Lo, Rep Hi>
+struct is_bounded<Bounded<Rep, Lo, Hi>> : std::true_type
+{};
+
+/// Concept for Bounded.
+template <class T>
+concept BoundedConcept = is_bounded<T>::value;
+
+namespace number_helper
+{
+template <std::signed_integral Rep, Rep Lo, Rep Hi>
+struct rep_traits<Bounded<Rep, Lo, Hi>>
+{
+    using compute_type = Rep;
+
+    static constexpr compute_type widen(const Bounded<Rep, Lo, Hi> value) { return value.value(); }
+
+    template <NumberConcept U>
+    static constexpr Bounded<Rep, Lo, Hi> narrow(const U value)
+    {
+        if constexpr (std::floating_point<U>)
+        {
+            const U clamped{std::clamp(value, static_cast<U>(Lo), static_cast<U>(Hi))};
+            return Bounded<Rep, Lo, Hi>::unchecked(static_cast<Rep>(clamped));
+        }
+        else if (std::cmp_less(value, Lo))
+        {
+            return Bounded<Rep, Lo, Hi>::unchecked(Lo);
+        }
+        else if (std::cmp_greater(value, Hi))
+        {
+            return Bounded<Rep, Lo, Hi>::unchecked(Hi);
+        }
+        else
+        {
+            return Bounded<Rep, Lo, Hi>::unchecked(static_cast<Rep>(value));
+        }
+    }
+};
+} // namespace number_helper
+
+namespace bounded_helper
+{
+/// The Bounded rep of the interval [Lo, Hi].
+template <std::signed_integral Rep, std::intmax_t Lo, std::intmax_t Hi>
+requires(Interval{Lo, Hi}.template fits<Rep>())
+using bounded_t = Bounded<Rep, static_cast<Rep>(Lo), static_cast<Rep>(Hi)>;
+
+/// The compound unit with the signatures of CU and another rep.
+template <CompoundUnitConcept CU, number_helper::RepConcept Rep>
+using with_rep_t =
+    type_helper::make_specialization_t<CompoundUnit,
+                                       typename CU::Signatures::template push_front_t<Rep>>;
+
+/// The range of a compound unit of a Bounded rep.
+template <CompoundUnitConcept CU>
+requires(BoundedConcept<typename CU::Rep>)
+constexpr Interval range_v{CU::Rep::kRange};
+
+/**
+ * Cast a bounded compound unit to the period of Target, as castAs does: count * den / num.
+ * @return the count in the period of Target, as a Bounded rep whose range is the cast range.
+ */
+template <CompoundUnitConcept Target, CompoundUnitConcept CU>
+requires(BoundedConcept<typename CU::Rep>)
+constexpr auto castBounded(const CU& from)
+{
+    using Rep = number_helper::compute_rep_t<typename CU::Rep>;
+    using ScalingRatio = std::ratio_divide<typename Target::Period, typename CU::Period>;
+
+    constexpr std::optional<Interval> scaled{
+        multiply(range_v<CU>, Interval{ScalingRatio::den, ScalingRatio::den})};
+    static_assert(scaled.has_value() && scaled->template fits<Rep>(),
+                  "The cast of the bounded rep may overflow the rep.");
+    constexpr std::optional<Interval> range{divide(scaled, ScalingRatio::num)};
+    using ResultRep = bounded_t<Rep, range->lo, range->hi>;
+
+    return ResultRep::unchecked(from.count().value() * static_cast<Rep>(ScalingRatio::den) /
+                                static_cast<Rep>(ScalingRatio::num));
+}
+} // namespace bounded_helper
+
+/// Range-propagating operators of compound units of Bounded reps.
+///@{
+/**
+ * Multiply two compound units of Bounded reps.
+ * @details E.g. CompoundUnit<Bounded<std::int64_t, 0, 100>, m> *
+ *          CompoundUnit<Bounded<std::int64_t, -10, 10>, m> =>
+ *          CompoundUnit<Bounded<std::int64_t, -1000, 1000>, m^2>, stored in std::int16_t.
+ */
+template <std::signed_integral LInt, LInt LLo, LInt LHi, UnitSignatureConcept... LSignatures,
+          std::signed_integral RInt, RInt RLo, RInt RHi, UnitSignatureConcept... RSignatures>
+constexpr auto operator*(const CompoundUnit<Bounded<LInt, LLo, LHi>, LSignatures...>& lhs,
+                         const CompoundUnit<Bounded<RInt, RLo, RHi>, RSignatures...>& rhs)
+{
+    using Rep = std::common_type_t<LInt, RInt>;
+    using ReturnType = decltype(compound_unit_helper::determineMultiplyReturnType(lhs, rhs));
+    using ScalingRatio = decltype(compound_unit_helper::determineScalingRatio(lhs, rhs));
+
+    // The count is computed as lhs * rhs * num / den, each intermediate value must fit Rep.
+    constexpr std::optional<bounded_helper::Interval> product{
+        bounded_helper::multiply(bounded_helper::Interval{LLo, LHi},
+                                 bounded_helper::Interval{RLo, RHi})};
+    constexpr std::optional<bounded_helper::Interval> scaled{bounded_helper::multiply(
+        product, bounded_helper::Interval{ScalingRatio::num, ScalingRatio::num})};
+    static_assert(scaled.has_value() && product->template fits<Rep>() &&
+                      scaled->template fits<Rep>(),
+                  "The product of the bounded reps may overflow the rep.");
+    constexpr std::optional<bounded_helper::Interval> range{
+        bounded_helper::divide(scaled, ScalingRatio::den)};
+    using ResultRep = bounded_helper::bounded_t<Rep, range->lo, range->hi>;
+
+    const ResultRep count{ResultRep::unchecked(
+        static_cast<Rep>(lhs.count().value()) * static_cast<Rep>(rhs.count().value()) *
+        static_cast<Rep>(ScalingRatio::num) / static_cast<Rep>(ScalingRatio::den))};
+    if constexpr (CompoundUnitConcept<ReturnType>)
+    {
+        return bounded_helper::with_rep_t<ReturnType, ResultRep>{count};
+    }
+    else
+    {
+        return count;
+    }
+}
+
+/**
+ * Add two castable compound units of Bounded reps.
+ * @details The result is in the common compound unit, e.g.
+ *          CompoundUnit<Bounded<std::int64_t, 0, 2>, km> +
+ *          CompoundUnit<Bounded<std::int64_t, 0, 500>, m> =>
+ *          CompoundUnit<Bounded<std::int64_t, 0, 2500>, m>.
+ */
+template <std::signed_integral LInt, LInt LLo, LInt LHi, UnitSignatureConcept... LSignatures,
+          std::signed_integral RInt, RInt RLo, RInt RHi, UnitSignatureConcept... RSignatures>
+requires(compound_unit_helper::are_compound_units_castable_v<
+         CompoundUnit<LInt, LSignatures...>, CompoundUnit<RInt, RSignatures...>>)
+constexpr auto operator+(const CompoundUnit<Bounded<LInt, LLo, LHi>, LSignatures...>& lhs,
+                         const CompoundUnit<Bounded<RInt, RLo, RHi>, RSignatures...>& rhs)
+{
+    using Rep = std::common_type_t<LInt, RInt>;
+    using Common = decltype(compound_unit_helper::determineCommonCompoundUnit(lhs, rhs));
+
+    const auto l = bounded_helper::castBounded<Common>(lhs);
+    const auto r = bounded_helper::castBounded<Common>(rhs);
+    constexpr std::optional<bounded_helper::Interval> sum{
+        bounded_helper::add(decltype(l)::kRange, decltype(r)::kRange)};
+    static_assert(sum.has_value() && sum->template fits<Rep>(),
+                  "The sum of the bounded reps may overflow the rep.");
+    using ResultRep = bounded_helper::bounded_t<Rep, sum->lo, sum->hi>;
+
+    return bounded_helper::with_rep_t<Common, ResultRep>{
+        ResultRep::unchecked(static_cast<Rep>(l.value()) + static_cast<Rep>(r.value()))};
+}
+
+/// Negate a compound unit of a Bounded rep, the range is mirrored.
+template <std::signed_integral Int, Int Lo, Int Hi, UnitSignatureConcept... Signatures>
+constexpr auto operator-(const CompoundUnit<Bounded<Int, Lo, Hi>, Signatures...>& operand)
+{
+    constexpr std::optional<bounded_helper::Interval> negated{
+        bounded_helper::negate(bounded_helper::Interval{Lo, Hi})};
+    static_assert(negated.has_value() && negated->template fits<Int>(),
+                  "The negation of the bounded rep may overflow the rep.");
+    using ResultRep = bounded_helper::bounded_t<Int, negated->lo, negated->hi>;
+
+    return CompoundUnit<ResultRep, Signatures...>{ResultRep::unchecked(-operand.count().value())};
+}
+
+/// Subtract two castable compound units of Bounded reps, i.e. lhs + (-rhs).
+template <std::signed_integral LInt, LInt LLo, LInt LHi, UnitSignatureConcept... LSignatures,
+          std::signed_integral RInt, RInt RLo, RInt RHi, UnitSignatureConcept... RSignatures>
+requires(compound_unit_helper::are_compound_units_castable_v<
+         CompoundUnit<LInt, LSignatures...>, CompoundUnit<RInt, RSignatures...>>)
+constexpr auto operator-(const CompoundUnit<Bounded<LInt, LLo, LHi>, LSignatures...>& lhs,
+                         const CompoundUnit<Bounded<RInt, RLo, RHi>, RSignatures...>& rhs)
+{
+    return lhs + (-rhs);
+}
+///@}
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_BOUNDED_H_
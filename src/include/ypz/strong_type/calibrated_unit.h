@@ -0,0 +1,227 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_CALIBRATED_UNIT_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_CALIBRATED_UNIT_H_
+
+#include <compare>
+#include <cstddef>
+#include <ratio>
+#include <span>
+#include <type_traits>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/number.h"
+
+namespace cpu
+{
+/**
+ * A period which is only known at runtime, e.g. the duration of a TSC tick in seconds.
+ * @details The period is relative to the base unit of the CalibratedUnit. Its inverse is cached,
+ *          so that the conversions in both directions are a multiply. Calibrate it once at
+ *          startup, before it is used by other threads.
+ */
+class RuntimePeriod
+{
+  public:
+    constexpr RuntimePeriod() = default;
+
+    explicit constexpr RuntimePeriod(const double period) : period_{period}, inverse_{1.0 / period}
+    {}
+
+    /// @brief Set the period, e.g. from a measurement.
+    constexpr void calibrate(const double period)
+    {
+        period_ = period;
+        inverse_ = 1.0 / period;
+    }
+
+    /// @brief The period in the base unit.
+    constexpr double period() const { return period_; }
+
+    /// @brief 1 / period().
+    constexpr double inverse() const { return inverse_; }
+
+  private:
+    double period_{1.0};
+    double inverse_{1.0};
+};
+
+namespace calibrated_helper
+{
+/// The compile time factor from Base to CU, the same as castAs<CU>(Base{1}) for a double rep.
+template <CompoundUnitConcept Base, CompoundUnitConcept CU>
+inline constexpr double static_factor_v{[] {
+    using ScalingRatio = std::ratio_divide<typename Base::Period, typename CU::Period>;
+    return static_cast<double>(ScalingRatio::num) / static_cast<double>(ScalingRatio::den);
+}()};
+
+/// The descriptor of a calibrated unit, an instance member only if it is per instance.
+///@{
+template <const RuntimePeriod* Period>
+struct Descriptor
+{
+    constexpr Descriptor() = default;
+
+    static constexpr const RuntimePeriod& get() { return *Period; }
+};
+
+template <>
+struct Descriptor<nullptr>
+{
+    constexpr explicit Descriptor(const RuntimePeriod& period) : period_{&period} {}
+
+    constexpr const RuntimePeriod& get() const { return *period_; }
+
+    const RuntimePeriod* period_;
+};
+///@}
+} // namespace calibrated_helper
+
+/**
+ * Compound unit whose period is a RuntimePeriod times the period of a static Base unit.
+ * @details The dimension is checked at compile time like for CompoundUnit, i.e. a calibrated unit
+ *          converts to the compound units castable with Base. The conversion to such a unit CU is
+ *          one multiply by period() times a compile time factor, and the conversion from it is a
+ *          multiply by the cached inverse.
+ *          The descriptor of the period is a global, e.g.
+ *              inline cpu::RuntimePeriod tsc_period{};
+ *              using Ticks = cpu::CalibratedUnit<std::uint64_t, NanoSecond_double, &tsc_period>;
+ *          or, with Period == nullptr, a reference held by each instance, e.g. per device.
+ * @tparam _Rep the underlying representation type of the count.
+ * @tparam _Base the static unit which the period is relative to.
+ * @tparam Period the global descriptor, or nullptr for a per-instance descriptor.
+ */
+template <class _Rep, CompoundUnitConcept _Base, const RuntimePeriod* Period = nullptr>
+requires(std::is_arithmetic_v<_Rep>)
+class CalibratedUnit
+{
+    using Descriptor = calibrated_helper::Descriptor<Period>;
+
+  public:
+    using Rep = _Rep;
+    using Base = _Base;
+
+    /// @brief Whether the descriptor is per instance.
+    static constexpr bool has_instance_period{Period == nullptr};
+
+    /// @brief Constructors.
+    ///@{
+    explicit constexpr CalibratedUnit(const _Rep count)
+    requires(!has_instance_period)
+        : count_{count}
+    {}
+
+    constexpr CalibratedUnit(const _Rep count, const RuntimePeriod& period)
+    requires(has_instance_period)
+        : count_{count}, descriptor_{period}
+    {}
+    ///@}
+
+    /// @brief Convert a castable compound unit, with a multiply by the cached inverse period.
+    ///@{
+    template <CompoundUnitConcept CU>
+    requires(!has_instance_period &&
+             compound_unit_helper::are_compound_units_castable_v<CU, _Base>)
+    static constexpr CalibratedUnit from(const CU& value)
+    {
+        return CalibratedUnit{convertFrom(value, Descriptor::get())};
+    }
+
+    template <CompoundUnitConcept CU>
+    requires(has_instance_period &&
+             compound_unit_helper::are_compound_units_castable_v<CU, _Base>)
+    static constexpr CalibratedUnit from(const CU& value, const RuntimePeriod& period)
+    {
+        return CalibratedUnit{convertFrom(value, period), period};
+    }
+    ///@}
+
+    constexpr _Rep count() const { return count_; }
+
+    /// @brief The runtime period, in the base unit.
+    constexpr const RuntimePeriod& period() const { return descriptor_.get(); }
+
+    /// @brief The factor from the count to the count of a castable compound unit.
+    template <CompoundUnitConcept CU>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, _Base>)
+    constexpr double factorTo() const
+    {
+        return period().period() * calibrated_helper::static_factor_v<_Base, CU>;
+    }
+
+    /// @brief Convert to a castable compound unit, with one multiply.
+    template <CompoundUnitConcept CU>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, _Base>)
+    constexpr CU as() const
+    {
+        return CU{number_helper::narrow<typename CU::Rep>(static_cast<double>(count_) *
+                                                          factorTo<CU>())};
+    }
+
+    template <CompoundUnitConcept CU>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, _Base>)
+    explicit constexpr operator CU() const
+    {
+        return as<CU>();
+    }
+
+    /// @brief Operators of calibrated units with the same global period. The per-instance periods
+    ///        may differ, convert them with as() first.
+    ///@{
+    constexpr CalibratedUnit operator+(const CalibratedUnit& rhs) const
+    requires(!has_instance_period)
+    {
+        return CalibratedUnit{static_cast<_Rep>(count_ + rhs.count_)};
+    }
+
+    constexpr CalibratedUnit operator-(const CalibratedUnit& rhs) const
+    requires(!has_instance_period)
+    {
+        return CalibratedUnit{static_cast<_Rep>(count_ - rhs.count_)};
+    }
+
+    constexpr std::partial_ordering operator<=>(const CalibratedUnit& rhs) const
+    requires(!has_instance_period)
+    {
+        return count_ <=> rhs.count_;
+    }
+
+    constexpr bool operator==(const CalibratedUnit& rhs) const
+    requires(!has_instance_period)
+    {
+        return count_ == rhs.count_;
+    }
+    ///@}
+
+  private:
+    template <CompoundUnitConcept CU>
+    static constexpr _Rep convertFrom(const CU& value, const RuntimePeriod& period)
+    {
+        return static_cast<_Rep>(static_cast<double>(number_helper::widen(value.count())) *
+                                 period.inverse() * calibrated_helper::static_factor_v<CU, _Base>);
+    }
+
+    _Rep count_;
+    [[no_unique_address]] Descriptor descriptor_{};
+};
+
+/**
+ * Convert a buffer of calibrated units with a global period to a castable compound unit.
+ * @details The factor is computed once, so each element is one multiply.
+ * @pre out.size() >= in.size()
+ */
+template <class Rep, CompoundUnitConcept Base, const RuntimePeriod* Period,
+          CompoundUnitConcept CU>
+requires(Period != nullptr && compound_unit_helper::are_compound_units_castable_v<CU, Base>)
+void calibratedCast(const std::span<const CalibratedUnit<Rep, Base, Period>> in,
+                    const std::span<CU> out)
+{
+    const double factor{calibrated_helper::static_factor_v<Base, CU> * Period->period()};
+    for (std::size_t i{0}; i < in.size(); ++i)
+    {
+        out[i] = CU{number_helper::narrow<typename CU::Rep>(static_cast<double>(in[i].count()) *
+                                                            factor)};
+    }
+}
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_CALIBRATED_UNIT_H_
@@ -4,23 +4,61 @@
 #include <compare>
 #include <cstdint>
 #include <ratio>
+#include <type_traits>
 
 #include "ypz/strong_type/helpers/number.h"
 #include "ypz/strong_type/helpers/type.h"
 #include "ypz/strong_type/signature.h"
+#if defined(CPU_STRONG_TYPE_INSTRUMENT)
+#include "ypz/strong_type/instrument.h"
+#endif
 
 namespace cpu
 {
+/// The cost of a conversion between two compound units, from the cheapest to the costliest.
+enum class ConversionCost : std::uint8_t
+{
+    Identity,      ///< Nothing to compute.
+    RepChange,     ///< Same period, only the rep is converted.
+    ExactMultiply, ///< The count is multiplied by an integer.
+    LossyDivide,   ///< The count is divided, which truncates an integer rep.
+};
+
+namespace compound_unit_helper
+{
+/// See conversion_cost_v. Declared here for the converting constructor of CompoundUnit.
+template <class From, class To>
+struct conversion_cost;
+
+/// Whether CPU_STRONG_TYPE_STRICT is defined, i.e. only the identity conversions are implicit.
+#if defined(CPU_STRONG_TYPE_STRICT)
+inline constexpr bool is_strict_mode_v{true};
+#else
+inline constexpr bool is_strict_mode_v{false};
+#endif
+} // namespace compound_unit_helper
+
+/// Tag to construct a compound unit with an uninitialized count, e.g. Meter{cpu::uninit}.
+struct uninit_t
+{
+    explicit uninit_t() = default;
+};
+
+/// See uninit_t.
+inline constexpr uninit_t uninit{};
+
 /**
  * Compound Unit
  * @details A compound unit consists of several one or several unit signatures
  *          with their respective exponents.
- * @tparam _Rep the underlying representation type. Must be a signed number.
+ * @tparam _Rep the underlying representation type. Must be a signed number, or a storage rep
+ *              (see number_helper::rep_traits) which is widened to its compute type in the
+ *              arithmetic operators.
  * @tparam _Signatures the unit signatures.
  * @pre     The number of signatures must be greater than 0.
  * @pre     The tags of each signature must be unique.
  */
-template <number_helper::SignedNumberConcept _Rep, UnitSignatureConcept... _Signatures>
+template <number_helper::RepConcept _Rep, UnitSignatureConcept... _Signatures>
 class CompoundUnit
 {
     static_assert(sizeof...(_Signatures) > 0);
@@ -46,9 +84,17 @@ class CompoundUnit
     /// @brief Construct from count.
     explicit constexpr CompoundUnit(const _Rep count) : count_{count} {}
 
-    /// @brief Construct from another castable compound unit.
-    template <number_helper::SignedNumberConcept _XRep, UnitSignatureConcept... _XSignatures>
-    constexpr CompoundUnit(const CompoundUnit<_XRep, _XSignatures...>& from);
+    /// @brief Leave the count uninitialized, e.g. for a buffer which is filled right after.
+    explicit constexpr CompoundUnit(uninit_t) {}
+
+    /// @brief Construct from another castable compound unit. With CPU_STRONG_TYPE_STRICT defined,
+    ///        it is explicit unless the conversion is the identity, see unit_cast().
+    template <number_helper::RepConcept _XRep, UnitSignatureConcept... _XSignatures>
+    constexpr explicit(compound_unit_helper::is_strict_mode_v &&
+                       compound_unit_helper::conversion_cost<CompoundUnit<_XRep, _XSignatures...>,
+                                                             CompoundUnit>::value !=
+                           ConversionCost::Identity)
+        CompoundUnit(const CompoundUnit<_XRep, _XSignatures...>& from);
     ///@}
 
     /// @brief Operator<=>
@@ -57,7 +103,8 @@ class CompoundUnit
     /// @brief Get the count of the underlying data.
     constexpr _Rep count() const { return count_; }
 
-  private:
+    /// @brief The count. It is public only to make CompoundUnit a structural type, so that a
+    ///        compound unit can be a non-type template argument (see constant.h). Use count().
     _Rep count_;
 };
 
@@ -65,13 +112,89 @@ class CompoundUnit
 template <class T>
 concept CompoundUnitConcept = type_helper::is_specialization_v<T, CompoundUnit>;
 
+namespace compound_unit_helper
+{
+/// The compound unit of a list of signatures, or Rep if the list is empty.
+template <number_helper::RepConcept Rep, class SignaturesList>
+struct unit_of_signatures
+{
+    using type = type_helper::make_specialization_t<
+        CompoundUnit, typename SignaturesList::template push_front_t<Rep>>;
+};
+
+template <number_helper::RepConcept Rep>
+struct unit_of_signatures<Rep, type_helper::TypeList<>>
+{
+    using type = Rep;
+};
+
+template <CompoundUnitConcept L, CompoundUnitConcept R>
+struct multiply_unit;
+
+template <number_helper::RepConcept _LRep, UnitSignatureConcept... _LSignatures,
+          number_helper::RepConcept _RRep, UnitSignatureConcept... _RSignatures>
+struct multiply_unit<CompoundUnit<_LRep, _LSignatures...>, CompoundUnit<_RRep, _RSignatures...>>
+    : unit_of_signatures<std::common_type_t<number_helper::result_rep_t<_LRep>,
+                                            number_helper::result_rep_t<_RRep>>,
+                         decltype(signature_helper::computeMultiplicationSignatures_impl(
+                             type_helper::TypeList<_LSignatures...>{},
+                             type_helper::TypeList<_RSignatures...>{}))>
+{};
+
+template <CompoundUnitConcept CU>
+struct inverse_unit;
+
+template <number_helper::RepConcept _Rep, UnitSignatureConcept... _Signatures>
+struct inverse_unit<CompoundUnit<_Rep, _Signatures...>>
+{
+    using type = CompoundUnit<_Rep, inverse_signature_t<_Signatures>...>;
+};
+
+template <CompoundUnitConcept CU, std::int32_t N>
+struct pow_unit;
+
+template <number_helper::RepConcept _Rep, UnitSignatureConcept... _Signatures, std::int32_t N>
+struct pow_unit<CompoundUnit<_Rep, _Signatures...>, N>
+{
+    using type = CompoundUnit<number_helper::result_rep_t<_Rep>,
+                              UnitSignature<typename _Signatures::Period, _Signatures::Exp * N,
+                                            typename _Signatures::Tag>...>;
+};
+} // namespace compound_unit_helper
+
+/**
+ * Type level unit algebra.
+ * @details Only the signatures and the rep of the result are computed, no operator is
+ *          instantiated, so that derived unit aliases are cheap to compile. The operators of
+ *          CompoundUnit return these types.
+ */
+///@{
+/// The type of L * R, a compound unit, or the common rep if all the dimensions cancel out.
+template <CompoundUnitConcept L, CompoundUnitConcept R>
+using multiply_unit_t = typename compound_unit_helper::multiply_unit<L, R>::type;
+
+/// The unit of 1 / CU, with the same rep.
+template <CompoundUnitConcept CU>
+using inverse_unit_t = typename compound_unit_helper::inverse_unit<CU>::type;
+
+/// The type of L / R, a compound unit, or the common rep if all the dimensions cancel out.
+template <CompoundUnitConcept L, CompoundUnitConcept R>
+using divide_unit_t = multiply_unit_t<L, inverse_unit_t<R>>;
+
+/// The unit of CU to the power of N, e.g. pow_unit_t<Meter, 3> for cubic meter. The rep is the
+/// compute rep of CU::Rep.
+template <CompoundUnitConcept CU, std::int32_t N>
+requires(N != 0)
+using pow_unit_t = typename compound_unit_helper::pow_unit<CU, N>::type;
+
 /// Type to get the multiplication result of two compound unit types.
 template <CompoundUnitConcept L, CompoundUnitConcept R>
-using MultiplyUnit = decltype(L{} * R{});
+using MultiplyUnit = multiply_unit_t<L, R>;
 
 /// Type to get the division result of two compound unit types.
 template <CompoundUnitConcept L, CompoundUnitConcept R>
-using DivideUnit = decltype(L{} / R{1});
+using DivideUnit = divide_unit_t<L, R>;
+///@}
 
 namespace compound_unit_helper
 {
@@ -84,8 +207,8 @@ namespace compound_unit_helper
  */
 template <CompoundUnitConcept T, CompoundUnitConcept U>
 constexpr bool are_compound_units_castable_v{
-    []<number_helper::SignedNumberConcept TRep, UnitSignatureConcept... TSignatures,
-       number_helper::SignedNumberConcept URep, UnitSignatureConcept... USignatures>(
+    []<number_helper::RepConcept TRep, UnitSignatureConcept... TSignatures,
+       number_helper::RepConcept URep, UnitSignatureConcept... USignatures>(
         CompoundUnit<TRep, TSignatures...>, CompoundUnit<URep, USignatures...>) -> bool {
         constexpr bool size_equal{sizeof...(TSignatures) == sizeof...(USignatures)};
         constexpr bool signatures_equal{type_helper::are_typelists_interchangeable_v<
@@ -104,21 +227,35 @@ constexpr bool are_compound_units_castable_v{
  * @tparam _FromSignatures the unit signatures of the source compound unit.
  * @param source the source compound unit.
  * @return the converted compound unit.
+ * @note With CPU_STRONG_TYPE_INSTRUMENT defined, the runtime conversions which scale the count or
+ *       change the rep are counted, see conversionReport().
  */
-template <CompoundUnitConcept TargetType, number_helper::SignedNumberConcept _FromRep,
+template <CompoundUnitConcept TargetType, number_helper::RepConcept _FromRep,
           UnitSignatureConcept... _FromSignatures>
 requires(compound_unit_helper::are_compound_units_castable_v<
          TargetType, CompoundUnit<_FromRep, _FromSignatures...>>)
 constexpr TargetType castAs(const CompoundUnit<_FromRep, _FromSignatures...>& source)
 {
     using FromType = CompoundUnit<_FromRep, _FromSignatures...>;
-    using CommonRep = std::common_type_t<_FromRep, typename TargetType::Rep>;
+    using TargetRep = typename TargetType::Rep;
+    using CommonRep = std::common_type_t<number_helper::compute_rep_t<_FromRep>,
+                                         number_helper::compute_rep_t<TargetRep>>;
 
     using ScalingRatio = std::ratio_divide<typename TargetType::Period, typename FromType::Period>;
 
-    return TargetType(static_cast<CommonRep>(source.count()) *
-                      static_cast<CommonRep>(ScalingRatio::den) /
-                      static_cast<CommonRep>(ScalingRatio::num));
+#if defined(CPU_STRONG_TYPE_INSTRUMENT)
+    if constexpr (!std::ratio_equal_v<ScalingRatio, std::ratio<1>> ||
+                  !std::same_as<_FromRep, TargetRep>)
+    {
+        if (!std::is_constant_evaluated())
+        {
+            instrument_helper::recordConversion<FromType, TargetType>();
+        }
+    }
+#endif
+    return TargetType(number_helper::narrow<TargetRep>(
+        static_cast<CommonRep>(number_helper::widen(source.count())) *
+        static_cast<CommonRep>(ScalingRatio::den) / static_cast<CommonRep>(ScalingRatio::num)));
 }
 
 /**
@@ -141,28 +278,13 @@ constexpr bool are_compound_unit_equal_v{[]() {
     return is_castable && std::same_as<typename T::Rep, typename U::Rep> && is_ratio_equal;
 }()};
 
-template <number_helper::SignedNumberConcept _LRep, UnitSignatureConcept... _LSignatures,
-          number_helper::SignedNumberConcept _RRep, UnitSignatureConcept... _RSignatures>
+template <number_helper::RepConcept _LRep, UnitSignatureConcept... _LSignatures,
+          number_helper::RepConcept _RRep, UnitSignatureConcept... _RSignatures>
 consteval auto determineMultiplyReturnType(CompoundUnit<_LRep, _LSignatures...> lhs,
                                            CompoundUnit<_RRep, _RSignatures...> rhs)
 {
-    using CommonRep = std::common_type_t<_LRep, _RRep>;
-    using LSignaturesList = type_helper::TypeList<_LSignatures...>;
-    using RSignaturesList = type_helper::TypeList<_RSignatures...>;
-
-    using SignaturesList = decltype(signature_helper::computeMultiplicationSignatures_impl(
-        LSignaturesList{}, RSignaturesList{}));
-
-    if constexpr (SignaturesList::size() > 0)
-    {
-        using ReturnType = type_helper::make_specialization_t<
-            CompoundUnit, typename SignaturesList::template push_front_t<CommonRep>>;
-        return ReturnType{};
-    }
-    else
-    {
-        return CommonRep{};
-    }
+    return multiply_unit_t<CompoundUnit<_LRep, _LSignatures...>,
+                           CompoundUnit<_RRep, _RSignatures...>>{};
 }
 
 template <CompoundUnitConcept LeftType, CompoundUnitConcept RightType>
@@ -177,15 +299,16 @@ consteval CompoundUnitConcept auto determineCommonCompoundUnit(const LeftType& l
         std::ratio_less_equal_v<typename LeftType::Period, typename RightType::Period>,
         typename LeftType::Signatures, typename RightType::Signatures>;
 
-    using CommonRep = std::common_type_t<typename LeftType::Rep, typename RightType::Rep>;
+    using CommonRep = std::common_type_t<number_helper::result_rep_t<typename LeftType::Rep>,
+                                         number_helper::result_rep_t<typename RightType::Rep>>;
     using ReturnType = type_helper::make_specialization_t<
         CompoundUnit, typename CommonSignatures::template push_front_t<CommonRep>>;
 
     return ReturnType{};
 }
 
-template <number_helper::SignedNumberConcept _LRep, UnitSignatureConcept... _LSignatures,
-          number_helper::SignedNumberConcept _RRep, UnitSignatureConcept... _RSignatures>
+template <number_helper::RepConcept _LRep, UnitSignatureConcept... _LSignatures,
+          number_helper::RepConcept _RRep, UnitSignatureConcept... _RSignatures>
 consteval auto determineScalingRatio(CompoundUnit<_LRep, _LSignatures...> lhs,
                                      CompoundUnit<_RRep, _RSignatures...> rhs)
 {
@@ -209,10 +332,51 @@ consteval auto determineScalingRatio(CompoundUnit<_LRep, _LSignatures...> lhs,
     return decltype(compute_scaling_ratio(TagsList{})){};
 }
 
+template <CompoundUnitConcept From, CompoundUnitConcept To>
+struct conversion_cost<From, To>
+{
+    using ScalingRatio = std::ratio_divide<typename To::Period, typename From::Period>;
+
+    /// The costliest step, a rep change is cheaper than any scaling.
+    static constexpr ConversionCost value{
+        ScalingRatio::num != 1                              ? ConversionCost::LossyDivide
+        : ScalingRatio::den != 1                            ? ConversionCost::ExactMultiply
+        : std::same_as<typename From::Rep, typename To::Rep> ? ConversionCost::Identity
+                                                            : ConversionCost::RepChange};
+};
+
+/// Whether the conversion from From to To is explicit, like the converting constructor of
+/// CompoundUnit: in the strict mode (CPU_STRONG_TYPE_STRICT), unless it is the identity.
+template <CompoundUnitConcept From, CompoundUnitConcept To>
+inline constexpr bool is_explicit_conversion_v{
+    is_strict_mode_v && conversion_cost<From, To>::value != ConversionCost::Identity};
 } // namespace compound_unit_helper
 
-template <number_helper::SignedNumberConcept _Rep, UnitSignatureConcept... _Signatures>
-template <number_helper::SignedNumberConcept _XRep, UnitSignatureConcept... _XSignatures>
+/**
+ * The cost of the conversion from From to To, computed from the scaling ratio of castAs.
+ * @details castAs computes count * ScalingRatio::den / ScalingRatio::num, so the conversion is an
+ *          exact multiply when ScalingRatio::num is 1, and a lossy divide otherwise. A rep change
+ *          alone has the cost RepChange.
+ */
+template <CompoundUnitConcept From, CompoundUnitConcept To>
+requires(compound_unit_helper::are_compound_units_castable_v<To, From>)
+inline constexpr ConversionCost conversion_cost_v{
+    compound_unit_helper::conversion_cost<From, To>::value};
+
+/**
+ * Cast a compound unit to another castable compound unit explicitly.
+ * @details The same conversion as the converting constructor, which is explicit in the strict mode
+ *          (CPU_STRONG_TYPE_STRICT) unless conversion_cost_v<From, To> is Identity.
+ */
+template <CompoundUnitConcept To, CompoundUnitConcept From>
+requires(compound_unit_helper::are_compound_units_castable_v<To, From>)
+constexpr To unit_cast(const From& from)
+{
+    return compound_unit_helper::castAs<To>(from);
+}
+
+template <number_helper::RepConcept _Rep, UnitSignatureConcept... _Signatures>
+template <number_helper::RepConcept _XRep, UnitSignatureConcept... _XSignatures>
 constexpr CompoundUnit<_Rep, _Signatures...>::CompoundUnit(
     const CompoundUnit<_XRep, _XSignatures...>& from)
     : CompoundUnit{compound_unit_helper::castAs<CompoundUnit<_Rep, _Signatures...>>(from)}
@@ -227,40 +391,42 @@ constexpr CompoundUnit<_Rep, _Signatures...>::CompoundUnit(
  * @return the result of the multiplication. Can be a compound unit or a number.
  *         The underlying Rep is the common Rep of lhs and rhs.
  */
-template <number_helper::SignedNumberConcept _LRep, UnitSignatureConcept... _LSignatures,
-          number_helper::SignedNumberConcept _RRep, UnitSignatureConcept... _RSignatures>
+template <number_helper::RepConcept _LRep, UnitSignatureConcept... _LSignatures,
+          number_helper::RepConcept _RRep, UnitSignatureConcept... _RSignatures>
 constexpr auto operator*(const CompoundUnit<_LRep, _LSignatures...>& lhs,
                          const CompoundUnit<_RRep, _RSignatures...>& rhs)
 {
-    using ReturnType = decltype(compound_unit_helper::determineMultiplyReturnType(lhs, rhs));
+    using ReturnType =
+        multiply_unit_t<CompoundUnit<_LRep, _LSignatures...>, CompoundUnit<_RRep, _RSignatures...>>;
     using ScalingRatio = decltype(compound_unit_helper::determineScalingRatio(lhs, rhs));
 
     if constexpr (CompoundUnitConcept<ReturnType>)
     {
-        return ReturnType(static_cast<ReturnType::Rep>(lhs.count()) *
-                          static_cast<ReturnType::Rep>(rhs.count()) * ScalingRatio::num /
-                          ScalingRatio::den);
+        return ReturnType(static_cast<ReturnType::Rep>(number_helper::widen(lhs.count())) *
+                          static_cast<ReturnType::Rep>(number_helper::widen(rhs.count())) *
+                          ScalingRatio::num / ScalingRatio::den);
     }
     else
     {
-        return ReturnType(static_cast<ReturnType>(lhs.count()) *
-                          static_cast<ReturnType>(rhs.count()) * ScalingRatio::num /
-                          ScalingRatio::den);
+        return ReturnType(static_cast<ReturnType>(number_helper::widen(lhs.count())) *
+                          static_cast<ReturnType>(number_helper::widen(rhs.count())) *
+                          ScalingRatio::num / ScalingRatio::den);
     }
 }
 
 /// Multiply a compound unit with a number.
-template <number_helper::SignedNumberConcept _LRep, UnitSignatureConcept... _LSignatures,
+template <number_helper::RepConcept _LRep, UnitSignatureConcept... _LSignatures,
           number_helper::SignedNumberConcept _Rhs>
 constexpr auto operator*(const CompoundUnit<_LRep, _LSignatures...>& lhs, const _Rhs rhs)
 {
-    using CommonRep = std::common_type_t<_LRep, _Rhs>;
+    using CommonRep = std::common_type_t<number_helper::result_rep_t<_LRep>, _Rhs>;
     using ReturnType = CompoundUnit<CommonRep, _LSignatures...>;
-    return ReturnType{static_cast<CommonRep>(lhs.count()) * static_cast<CommonRep>(rhs)};
+    return ReturnType{static_cast<CommonRep>(
+        static_cast<CommonRep>(number_helper::widen(lhs.count())) * static_cast<CommonRep>(rhs))};
 }
 
 /// Multiply a number with a compound unit.
-template <number_helper::SignedNumberConcept _Lhs, number_helper::SignedNumberConcept _RRep,
+template <number_helper::SignedNumberConcept _Lhs, number_helper::RepConcept _RRep,
           UnitSignatureConcept... _RSignatures>
 constexpr auto operator*(const _Lhs lhs, const CompoundUnit<_RRep, _RSignatures...>& rhs)
 {
@@ -278,65 +444,74 @@ constexpr auto operator*(const _Lhs lhs, const CompoundUnit<_RRep, _RSignatures.
  * @return the result of the division. Can be a compound unit or a number.
  *         The underlying Rep is the common Rep of lhs and rhs.
  */
-template <number_helper::SignedNumberConcept _LRep, UnitSignatureConcept... _LSignatures,
-          number_helper::SignedNumberConcept _RRep, UnitSignatureConcept... _RSignatures>
+template <number_helper::RepConcept _LRep, UnitSignatureConcept... _LSignatures,
+          number_helper::RepConcept _RRep, UnitSignatureConcept... _RSignatures>
 constexpr auto operator/(const CompoundUnit<_LRep, _LSignatures...>& lhs,
                          const CompoundUnit<_RRep, _RSignatures...>& rhs)
 {
     using RInverseCompoundUnit = CompoundUnit<_RRep, inverse_signature_t<_RSignatures>...>;
 
     using ReturnType =
-        decltype(compound_unit_helper::determineMultiplyReturnType(lhs, RInverseCompoundUnit{}));
+        divide_unit_t<CompoundUnit<_LRep, _LSignatures...>, CompoundUnit<_RRep, _RSignatures...>>;
     using ScalingRatio =
         decltype(compound_unit_helper::determineScalingRatio(lhs, RInverseCompoundUnit{}));
 
     if constexpr (CompoundUnitConcept<ReturnType>)
     {
-        return ReturnType(static_cast<ReturnType::Rep>(lhs.count()) * ScalingRatio::num /
-                          static_cast<ReturnType::Rep>(rhs.count()) / ScalingRatio::den);
+        return ReturnType(static_cast<ReturnType::Rep>(number_helper::widen(lhs.count())) *
+                          ScalingRatio::num /
+                          static_cast<ReturnType::Rep>(number_helper::widen(rhs.count())) /
+                          ScalingRatio::den);
     }
     else
     {
-        return ReturnType(static_cast<ReturnType>(lhs.count()) * ScalingRatio::num /
-                          static_cast<ReturnType>(rhs.count()) / ScalingRatio::den);
+        return ReturnType(static_cast<ReturnType>(number_helper::widen(lhs.count())) *
+                          ScalingRatio::num /
+                          static_cast<ReturnType>(number_helper::widen(rhs.count())) /
+                          ScalingRatio::den);
     }
 }
 
 /// Divide a compound unit by a number.
-template <number_helper::SignedNumberConcept _LRep, UnitSignatureConcept... _LSignatures,
+template <number_helper::RepConcept _LRep, UnitSignatureConcept... _LSignatures,
           number_helper::SignedNumberConcept _Rhs>
 constexpr auto operator/(const CompoundUnit<_LRep, _LSignatures...>& lhs, const _Rhs rhs)
 {
-    using CommonRep = std::common_type_t<_LRep, _Rhs>;
+    using CommonRep = std::common_type_t<number_helper::result_rep_t<_LRep>, _Rhs>;
     using ReturnType = CompoundUnit<CommonRep, _LSignatures...>;
-    return ReturnType{static_cast<CommonRep>(lhs.count()) / static_cast<CommonRep>(rhs)};
+    return ReturnType{static_cast<CommonRep>(
+        static_cast<CommonRep>(number_helper::widen(lhs.count())) / static_cast<CommonRep>(rhs))};
 }
 
 ///@}
 
 /// Unary Operator- overloads for CompoundUnit.
-template <number_helper::SignedNumberConcept _Rep, UnitSignatureConcept... _Signatures>
+template <number_helper::RepConcept _Rep, UnitSignatureConcept... _Signatures>
 constexpr auto operator-(const CompoundUnit<_Rep, _Signatures...>& operand)
 {
-    return CompoundUnit<_Rep, _Signatures...>{-operand.count()};
+    using ResultRep = number_helper::result_rep_t<_Rep>;
+    return CompoundUnit<ResultRep, _Signatures...>{
+        static_cast<ResultRep>(-number_helper::widen(operand.count()))};
 }
 
 /// Operator+ overloads for CompoundUnit.
-template <number_helper::SignedNumberConcept _LRep, UnitSignatureConcept... _LSignatures,
-          number_helper::SignedNumberConcept _RRep, UnitSignatureConcept... _RSignatures>
+template <number_helper::RepConcept _LRep, UnitSignatureConcept... _LSignatures,
+          number_helper::RepConcept _RRep, UnitSignatureConcept... _RSignatures>
 requires(compound_unit_helper::are_compound_units_castable_v<CompoundUnit<_LRep, _LSignatures...>,
                                                              CompoundUnit<_RRep, _RSignatures...>>)
 constexpr auto operator+(const CompoundUnit<_LRep, _LSignatures...>& lhs,
                          const CompoundUnit<_RRep, _RSignatures...>& rhs)
 {
     using ReturnType = decltype(compound_unit_helper::determineCommonCompoundUnit(lhs, rhs));
+    using Rep = typename ReturnType::Rep;
 
-    return ReturnType{static_cast<ReturnType>(lhs).count() + static_cast<ReturnType>(rhs).count()};
+    return ReturnType{static_cast<Rep>(static_cast<ReturnType>(lhs).count() +
+                                       static_cast<ReturnType>(rhs).count())};
 }
 
 /// Operator- overloads for CompoundUnit.
-template <number_helper::SignedNumberConcept _LRep, UnitSignatureConcept... _LSignatures,
-          number_helper::SignedNumberConcept _RRep, UnitSignatureConcept... _RSignatures>
+template <number_helper::RepConcept _LRep, UnitSignatureConcept... _LSignatures,
+          number_helper::RepConcept _RRep, UnitSignatureConcept... _RSignatures>
 requires(compound_unit_helper::are_compound_units_castable_v<CompoundUnit<_LRep, _LSignatures...>,
                                                              CompoundUnit<_RRep, _RSignatures...>>)
 constexpr auto operator-(const CompoundUnit<_LRep, _LSignatures...>& lhs,
@@ -362,6 +537,21 @@ constexpr std::partial_ordering operator<=>(const LeftType& lhs, const RightType
     return static_cast<CommonType>(lhs) <=> static_cast<CommonType>(rhs);
 }
 
+/**
+ * Operator== overloads for CompoundUnit, != is rewritten from it.
+ * @details The defaulted operator== of CompoundUnit only takes the same type, and operator<=>
+ *          is not used to rewrite ==, so that the castable units of different types are compared
+ *          here, also when the converting constructor is explicit (CPU_STRONG_TYPE_STRICT).
+ */
+template <CompoundUnitConcept LeftType, CompoundUnitConcept RightType>
+requires(!std::same_as<LeftType, RightType> &&
+         compound_unit_helper::are_compound_units_castable_v<LeftType, RightType>)
+constexpr bool operator==(const LeftType& lhs, const RightType& rhs)
+{
+    using CommonType = decltype(compound_unit_helper::determineCommonCompoundUnit(lhs, rhs));
+    return static_cast<CommonType>(lhs) == static_cast<CommonType>(rhs);
+}
+
 } // namespace cpu
 
 #endif // SRC_INCLUDE_YPZ_STRONG_TYPE_COMPOUND_UNIT_H_
@@ -0,0 +1,241 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_CONSTANT_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_CONSTANT_H_
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <type_traits>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/number.h"
+#include "ypz/strong_type/helpers/type.h"
+
+namespace cpu
+{
+/**
+ * Compile time constant of a compound unit, e.g. Constant<Meter{5}>.
+ * @details The value is a non-type template argument, so kernels can be specialized on it, and
+ *          the operators with a runtime compound unit use the value pre-scaled to the period of
+ *          the operand, i.e. it becomes an immediate in the generated code. The operators of two
+ *          constants are evaluated at compile time and return a constant.
+ * @tparam Value the compound unit value. Its rep must be a structural type, e.g. an integer or
+ *         a floating point number.
+ */
+template <CompoundUnitConcept auto Value>
+struct Constant
+{
+    /// @brief The compound unit of the value.
+    using Unit = std::remove_cv_t<decltype(Value)>;
+
+    /// @brief The value.
+    static constexpr Unit value{Value};
+
+    /// @brief The value cast to a castable compound unit, at compile time.
+    template <CompoundUnitConcept CU>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, Unit>)
+    static constexpr CU as{Value};
+
+    /// @brief Convert to a castable compound unit.
+    template <CompoundUnitConcept CU>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, Unit>)
+    constexpr operator CU() const
+    {
+        return as<CU>;
+    }
+};
+
+/// Compile time constant of a compound unit, e.g. cpu::constant<Meter{5}>.
+template <CompoundUnitConcept auto Value>
+inline constexpr Constant<Value> constant{};
+
+/// Concept for Constant.
+template <class T>
+concept ConstantConcept = requires {
+    typename T::Unit;
+    requires std::same_as<std::remove_cv_t<T>, Constant<T::value>>;
+};
+
+namespace constant_helper
+{
+/// The compound unit in which a runtime operand and a constant are added or compared.
+template <CompoundUnitConcept CU, ConstantConcept C>
+using common_unit_t =
+    decltype(compound_unit_helper::determineCommonCompoundUnit(CU{}, typename C::Unit{}));
+
+/**
+ * The constant factor of lhs * C, i.e. the count of C times the scaling ratio of the product.
+ * @details It is only used when it is exact, i.e. for floating point reps, or when the scaling
+ *          does not truncate the integer count.
+ */
+template <CompoundUnitConcept CU, ConstantConcept C>
+struct product_factor
+{
+    using ScalingRatio =
+        decltype(compound_unit_helper::determineScalingRatio(CU{}, typename C::Unit{}));
+    using CommonRep = std::common_type_t<number_helper::compute_rep_t<typename CU::Rep>,
+                                         number_helper::compute_rep_t<typename C::Unit::Rep>>;
+
+    static constexpr CommonRep scaled{static_cast<CommonRep>(
+        number_helper::widen(C::value.count()) * static_cast<CommonRep>(ScalingRatio::num))};
+    static constexpr bool is_exact{[] {
+        if constexpr (std::floating_point<CommonRep>)
+        {
+            return true;
+        }
+        else
+        {
+            return scaled % static_cast<CommonRep>(ScalingRatio::den) == 0;
+        }
+    }()};
+    static constexpr CommonRep value{scaled / static_cast<CommonRep>(ScalingRatio::den)};
+};
+} // namespace constant_helper
+
+/// Operators of two constants, evaluated at compile time.
+///@{
+template <auto L, auto R>
+constexpr auto operator*(Constant<L>, Constant<R>)
+{
+    if constexpr (CompoundUnitConcept<decltype(L * R)>)
+    {
+        return constant<L * R>;
+    }
+    else
+    {
+        return L * R;
+    }
+}
+
+template <auto L, auto R>
+constexpr auto operator/(Constant<L>, Constant<R>)
+{
+    if constexpr (CompoundUnitConcept<decltype(L / R)>)
+    {
+        return constant<L / R>;
+    }
+    else
+    {
+        return L / R;
+    }
+}
+
+template <auto L, auto R>
+requires(compound_unit_helper::are_compound_units_castable_v<typename Constant<L>::Unit,
+                                                             typename Constant<R>::Unit>)
+constexpr auto operator+(Constant<L>, Constant<R>)
+{
+    return constant<L + R>;
+}
+
+template <auto L, auto R>
+requires(compound_unit_helper::are_compound_units_castable_v<typename Constant<L>::Unit,
+                                                             typename Constant<R>::Unit>)
+constexpr auto operator-(Constant<L>, Constant<R>)
+{
+    return constant<L - R>;
+}
+
+template <auto V>
+constexpr auto operator-(Constant<V>)
+{
+    return constant<-V>;
+}
+///@}
+
+/// Operators of a compound unit and a constant, with the constant pre-scaled at compile time.
+///@{
+/// Multiply, the count of the constant and the scaling ratio are folded into one factor.
+template <CompoundUnitConcept CU, auto V>
+constexpr auto operator*(const CU& lhs, Constant<V> rhs)
+{
+    using Factor = constant_helper::product_factor<CU, Constant<V>>;
+    if constexpr (Factor::is_exact)
+    {
+        using ReturnType = decltype(lhs * V);
+        using CommonRep = typename Factor::CommonRep;
+        const CommonRep count{static_cast<CommonRep>(number_helper::widen(lhs.count())) *
+                              Factor::value};
+        if constexpr (CompoundUnitConcept<ReturnType>)
+        {
+            return ReturnType{static_cast<typename ReturnType::Rep>(count)};
+        }
+        else
+        {
+            return static_cast<ReturnType>(count);
+        }
+    }
+    else
+    {
+        return lhs * rhs.value;
+    }
+}
+
+template <auto V, CompoundUnitConcept CU>
+constexpr auto operator*(Constant<V> lhs, const CU& rhs)
+{
+    return rhs * lhs;
+}
+
+template <CompoundUnitConcept CU, auto V>
+constexpr auto operator/(const CU& lhs, Constant<V>)
+{
+    return lhs / V;
+}
+
+template <CompoundUnitConcept CU, auto V>
+requires(compound_unit_helper::are_compound_units_castable_v<CU, typename Constant<V>::Unit>)
+constexpr auto operator+(const CU& lhs, Constant<V>)
+{
+    using Common = constant_helper::common_unit_t<CU, Constant<V>>;
+    return lhs + Constant<V>::template as<Common>;
+}
+
+template <auto V, CompoundUnitConcept CU>
+requires(compound_unit_helper::are_compound_units_castable_v<CU, typename Constant<V>::Unit>)
+constexpr auto operator+(Constant<V> lhs, const CU& rhs)
+{
+    return rhs + lhs;
+}
+
+template <CompoundUnitConcept CU, auto V>
+requires(compound_unit_helper::are_compound_units_castable_v<CU, typename Constant<V>::Unit>)
+constexpr auto operator-(const CU& lhs, Constant<V>)
+{
+    using Common = constant_helper::common_unit_t<CU, Constant<V>>;
+    return lhs - Constant<V>::template as<Common>;
+}
+
+template <CompoundUnitConcept CU, auto V>
+requires(compound_unit_helper::are_compound_units_castable_v<CU, typename Constant<V>::Unit>)
+constexpr std::partial_ordering operator<=>(const CU& lhs, Constant<V>)
+{
+    using Common = constant_helper::common_unit_t<CU, Constant<V>>;
+    return Common{lhs} <=> Constant<V>::template as<Common>;
+}
+
+template <CompoundUnitConcept CU, auto V>
+requires(compound_unit_helper::are_compound_units_castable_v<CU, typename Constant<V>::Unit>)
+constexpr bool operator==(const CU& lhs, Constant<V> rhs)
+{
+    return (lhs <=> rhs) == 0;
+}
+///@}
+
+/**
+ * Clamp a compound unit into [Lo, Hi], where the bounds are compile time constants.
+ * @details The bounds are cast to the unit of the operand at compile time, e.g.
+ *          clamp<Km{1}, Km{2}>(Meter{1500}) compares the count with the immediates 1000 and 2000.
+ */
+template <CompoundUnitConcept auto Lo, CompoundUnitConcept auto Hi, CompoundUnitConcept CU>
+requires(compound_unit_helper::are_compound_units_castable_v<CU, typename Constant<Lo>::Unit> &&
+         compound_unit_helper::are_compound_units_castable_v<CU, typename Constant<Hi>::Unit>)
+constexpr CU clamp(const CU& value)
+{
+    static_assert(Lo <= Hi, "The lower bound shall not be greater than the upper bound.");
+    return CU{std::clamp(value.count(), Constant<Lo>::template as<CU>.count(),
+                         Constant<Hi>::template as<CU>.count())};
+}
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_CONSTANT_H_
@@ -0,0 +1,471 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_CSV_READER_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_CSV_READER_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#endif
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/formula.h"
+#include "ypz/strong_type/helpers/number.h"
+#include "ypz/strong_type/unit_array.h"
+
+namespace cpu
+{
+/**
+ * Read-only view of a whole file, memory-mapped where the platform supports it.
+ * @details On other platforms the file is read into memory.
+ */
+class MappedFile
+{
+  public:
+    /// @brief Map a file, std::nullopt if it cannot be opened or mapped.
+    static std::optional<MappedFile> open(const std::string& path)
+    {
+        MappedFile ret{};
+#if defined(__unix__) || defined(__APPLE__)
+        const int fd{::open(path.c_str(), O_RDONLY)};
+        if (fd < 0)
+        {
+            return std::nullopt;
+        }
+        struct stat info
+        {};
+        const bool stat_ok{::fstat(fd, &info) == 0};
+        ret.size_ = stat_ok ? static_cast<std::size_t>(info.st_size) : 0;
+        void* const data{stat_ok && ret.size_ > 0
+                             ? ::mmap(nullptr, ret.size_, PROT_READ, MAP_PRIVATE, fd, 0)
+                             : nullptr};
+        ::close(fd);
+        if (!stat_ok || data == MAP_FAILED)
+        {
+            return std::nullopt;
+        }
+        if (data != nullptr)
+        {
+            ::madvise(data, ret.size_, MADV_SEQUENTIAL);
+        }
+        ret.data_ = static_cast<const char*>(data);
+#else
+        std::ifstream file{path, std::ios::binary};
+        if (!file)
+        {
+            return std::nullopt;
+        }
+        ret.buffer_.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+        ret.data_ = ret.buffer_.data();
+        ret.size_ = ret.buffer_.size();
+#endif
+        return ret;
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+#if !defined(__unix__) && !defined(__APPLE__)
+        std::swap(buffer_, other.buffer_);
+        data_ = buffer_.data();
+        other.data_ = other.buffer_.data();
+#endif
+        return *this;
+    }
+
+    ~MappedFile()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+    }
+
+    /// @brief The content of the file.
+    std::string_view text() const { return {data_, size_}; }
+
+  private:
+    MappedFile() = default;
+
+    const char* data_{nullptr};
+    std::size_t size_{0};
+#if !defined(__unix__) && !defined(__APPLE__)
+    std::string buffer_{};
+#endif
+};
+
+/// Binding of a CSV column, found by the name in its header cell, to a UnitArray.
+template <CompoundUnitConcept CU>
+struct CsvColumn
+{
+    std::string_view name;
+    UnitArray<CU>* target;
+};
+
+/// Bind the CSV column `name` to `target`.
+template <CompoundUnitConcept CU>
+CsvColumn<CU> csvColumn(const std::string_view name, UnitArray<CU>& target)
+{
+    return {name, &target};
+}
+
+namespace csv_helper
+{
+/// A header cell, e.g. "speed[km/h]" has the name "speed" and the unit "km/h".
+struct HeaderCell
+{
+    std::string_view name;
+    std::string_view unit;
+};
+
+inline std::string_view trim(std::string_view text)
+{
+    while (!text.empty() && (text.front() == ' ' || text.front() == '\t'))
+    {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r'))
+    {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+/// Call f(line) for every non-empty line of the text.
+template <class F>
+void forEachLine(std::string_view text, F f)
+{
+    while (!text.empty())
+    {
+        const std::size_t end{text.find('\n')};
+        std::string_view line{text.substr(0, end)};
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.remove_suffix(1);
+        }
+        if (!line.empty())
+        {
+            f(line);
+        }
+        if (end == std::string_view::npos)
+        {
+            break;
+        }
+        text.remove_prefix(end + 1);
+    }
+}
+
+/// Split a text into at most `count` chunks of about the same size, each ending at a newline.
+inline std::vector<std::string_view> splitChunks(std::string_view text, const std::size_t count)
+{
+    std::vector<std::string_view> ret{};
+    const std::size_t target{text.size() / std::max<std::size_t>(count, 1) + 1};
+    while (!text.empty())
+    {
+        std::size_t end{text.size()};
+        if (target < text.size())
+        {
+            const std::size_t newline{text.find('\n', target)};
+            end = newline == std::string_view::npos ? text.size() : newline + 1;
+        }
+        ret.push_back(text.substr(0, end));
+        text.remove_prefix(end);
+    }
+    return ret;
+}
+
+inline std::optional<HeaderCell> parseHeaderCell(std::string_view cell)
+{
+    cell = trim(cell);
+    const std::size_t open{cell.find('[')};
+    if (open == std::string_view::npos)
+    {
+        return HeaderCell{cell, {}};
+    }
+    if (cell.back() != ']')
+    {
+        return std::nullopt;
+    }
+    return HeaderCell{trim(cell.substr(0, open)),
+                      trim(cell.substr(open + 1, cell.size() - open - 2))};
+}
+
+/**
+ * Resolve a unit expression of symbols, e.g. "km/h" or "kg*m/s/s".
+ * @details The expression is compiled by the formula compiler, whose inputs are the symbols. It
+ *          must only consist of products and quotients of symbols.
+ */
+inline std::optional<DynamicUnit> resolveUnit(const std::string_view text,
+                                              const std::span<const FormulaInput> symbols)
+{
+    formula_helper::Compiler compiler{text, symbols};
+    const std::optional<formula_helper::Compiler::Operand> unit{compiler.compile()};
+    const bool only_symbols{std::all_of(
+        compiler.code().begin(), compiler.code().end(),
+        [](const formula_helper::Instruction& instruction) {
+            return instruction.op == formula_helper::OpCode::Multiply ||
+                   instruction.op == formula_helper::OpCode::Divide ||
+                   (instruction.op == formula_helper::OpCode::Load && instruction.constant == 1.0);
+        })};
+    if (!unit || unit->constant || !only_symbols)
+    {
+        return std::nullopt;
+    }
+    return unit->unit;
+}
+
+inline std::optional<double> parseNumber(std::string_view field)
+{
+    field = trim(field);
+    if (!field.empty() && field.front() == '+')
+    {
+        field.remove_prefix(1);
+    }
+    double value{};
+    const auto [end, ec] = std::from_chars(field.data(), field.data() + field.size(), value);
+    if (ec != std::errc{} || end != field.data() + field.size())
+    {
+        return std::nullopt;
+    }
+    return value;
+}
+
+/// The rep of a parsed and scaled value, rounded to the nearest integer for an integral rep, e.g.
+/// "4.35" m in CentiMeter is 435, not 434 from the truncation of 434.99999999999994.
+template <class Rep>
+Rep toRep(const double value)
+{
+    if constexpr (std::integral<Rep>)
+    {
+        return number_helper::narrow<Rep>(std::llround(value));
+    }
+    else
+    {
+        return number_helper::narrow<Rep>(value);
+    }
+}
+} // namespace csv_helper
+
+/**
+ * Read the columns of a CSV text into unit arrays.
+ * @details The header cells declare the units of the columns, e.g. "speed[km/h]", which are
+ *          resolved once with the symbols, e.g. {"km", DynamicUnit::of<Km>()}, and checked
+ *          against the units of the arrays. The body is split into newline-aligned chunks,
+ *          which are parsed in parallel with std::from_chars and written straight into the
+ *          arrays, scaled by one factor per column and rounded to the nearest integer for an
+ *          integral rep.
+ *          Only numeric fields are supported, without quoting. Columns which are not bound are
+ *          skipped. Empty lines are ignored.
+ * @param text the CSV text, e.g. MappedFile::text().
+ * @param symbols the unit symbols of the header cells.
+ * @param threads the number of threads, 0 for std::thread::hardware_concurrency().
+ * @param columns the bindings of the columns, see csvColumn().
+ * @return the number of rows, or std::nullopt if a bound column is missing, a unit cannot be
+ *         resolved or is not castable to the array, or a field cannot be parsed. On a parse
+ *         error the content of the arrays is unspecified.
+ */
+template <CompoundUnitConcept... CUs>
+requires(sizeof...(CUs) > 0)
+std::optional<std::size_t> readCsv(std::string_view text,
+                                   const std::span<const FormulaInput> symbols,
+                                   std::size_t threads, const CsvColumn<CUs>... columns)
+{
+    constexpr std::size_t kColumns{sizeof...(CUs)};
+    // The chunks are large enough to amortize the thread start.
+    constexpr std::size_t kMinChunkSize{1U << 20};
+
+    // Resolve the header.
+    const std::size_t header_end{std::min(text.find('\n'), text.size())};
+    std::vector<csv_helper::HeaderCell> cells{};
+    for (std::string_view header{text.substr(0, header_end)};;)
+    {
+        const std::size_t comma{header.find(',')};
+        const std::optional<csv_helper::HeaderCell> cell{
+            csv_helper::parseHeaderCell(header.substr(0, comma))};
+        if (!cell)
+        {
+            return std::nullopt;
+        }
+        cells.push_back(*cell);
+        if (comma == std::string_view::npos)
+        {
+            break;
+        }
+        header.remove_prefix(comma + 1);
+    }
+    text.remove_prefix(std::min(header_end + 1, text.size()));
+
+    std::array<std::size_t, kColumns> field_of{};
+    std::array<double, kColumns> factor_of{};
+    const std::array<std::string_view, kColumns> names{columns.name...};
+    const std::array<DynamicUnit, kColumns> units{DynamicUnit::of<CUs>()...};
+    for (std::size_t i{0}; i < kColumns; ++i)
+    {
+        const auto cell = std::find_if(cells.begin(), cells.end(),
+                                       [&](const auto& c) { return c.name == names[i]; });
+        if (cell == cells.end())
+        {
+            return std::nullopt;
+        }
+        const std::optional<DynamicUnit> unit{csv_helper::resolveUnit(cell->unit, symbols)};
+        if (!unit || !unit->hasSameDimension(units[i]))
+        {
+            return std::nullopt;
+        }
+        field_of[i] = static_cast<std::size_t>(cell - cells.begin());
+        factor_of[i] = unit->scale() / units[i].scale();
+    }
+    const std::size_t fields{*std::max_element(field_of.begin(), field_of.end()) + 1};
+
+    // Split the body, each worker counts the rows of its chunk. The last one to arrive at the
+    // barrier allocates the arrays once, then each worker parses its chunk into its own rows.
+    if (threads == 0)
+    {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    threads = std::clamp<std::size_t>(text.size() / kMinChunkSize, 1, threads);
+    const std::vector<std::string_view> chunks{csv_helper::splitChunks(text, threads)};
+    if (chunks.empty())
+    {
+        (columns.target->resize(0, uninit), ...);
+        return 0;
+    }
+    std::vector<std::size_t> first_row(chunks.size() + 1, 0);
+    bool allocated{true};
+    const auto allocate = [&]() noexcept {
+        std::partial_sum(first_row.begin(), first_row.end(), first_row.begin());
+        try
+        {
+            (columns.target->resize(first_row.back(), uninit), ...);
+        }
+        catch (...)
+        {
+            allocated = false;
+        }
+    };
+    std::barrier counted{static_cast<std::ptrdiff_t>(chunks.size()), allocate};
+
+    std::atomic<bool> failed{false};
+    const auto parse_chunk = [&](const std::size_t chunk) {
+        std::size_t rows{0};
+        csv_helper::forEachLine(chunks[chunk], [&rows](std::string_view) { ++rows; });
+        first_row[chunk + 1] = rows;
+        counted.arrive_and_wait();
+        if (!allocated)
+        {
+            return;
+        }
+
+        std::vector<std::string_view> row_fields(fields);
+        std::size_t row{first_row[chunk]};
+        csv_helper::forEachLine(chunks[chunk], [&](std::string_view line) {
+            for (std::size_t f{0}; f < fields; ++f)
+            {
+                const std::size_t comma{line.find(',')};
+                row_fields[f] = line.substr(0, comma);
+                line.remove_prefix(comma == std::string_view::npos ? line.size() : comma + 1);
+            }
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                (
+                    [&] {
+                        using CU = std::tuple_element_t<Is, std::tuple<CUs...>>;
+                        const std::optional<double> value{
+                            csv_helper::parseNumber(row_fields[field_of[Is]])};
+                        if (!value)
+                        {
+                            failed.store(true, std::memory_order_relaxed);
+                            return;
+                        }
+                        std::get<Is>(std::tie(columns...)).target->data()[row] =
+                            CU{csv_helper::toRep<typename CU::Rep>(*value * factor_of[Is])};
+                    }(),
+                    ...);
+            }(std::index_sequence_for<CUs...>());
+            ++row;
+        });
+    };
+
+    std::vector<std::thread> workers{};
+    workers.reserve(chunks.size() - 1);
+    const auto join = [&workers] {
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+    };
+    std::size_t chunk{1};
+    try
+    {
+        for (; chunk < chunks.size(); ++chunk)
+        {
+            workers.emplace_back(parse_chunk, chunk);
+        }
+    }
+    catch (...)
+    {
+        // A thread could not be started. Its chunk, the next ones and the one of the calling
+        // thread never arrive at the barrier, drop them so that the started workers finish.
+        for (; chunk < chunks.size(); ++chunk)
+        {
+            counted.arrive_and_drop();
+        }
+        counted.arrive_and_drop();
+        join();
+        throw;
+    }
+    try
+    {
+        parse_chunk(0);
+    }
+    catch (...)
+    {
+        join();
+        throw;
+    }
+    join();
+
+    if (!allocated)
+    {
+        throw std::bad_alloc{};
+    }
+    if (failed.load())
+    {
+        return std::nullopt;
+    }
+    return first_row.back();
+}
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_CSV_READER_H_
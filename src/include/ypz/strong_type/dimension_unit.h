@@ -0,0 +1,461 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_DIMENSION_UNIT_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_DIMENSION_UNIT_H_
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/number.h"
+#include "ypz/strong_type/helpers/type.h"
+#include "ypz/strong_type/signature.h"
+
+namespace cpu
+{
+/**
+ * A fixed, ordered set of dimensions, e.g. DimensionSystem<LengthTag, MassTag, TimeTag>.
+ * @tparam Tags the tags of the dimensions, the same tags as in the UnitSignatures.
+ */
+template <class... Tags>
+struct DimensionSystem
+{
+    static_assert(sizeof...(Tags) > 0);
+    static_assert(type_helper::is_each_type_unique<type_helper::TypeList<Tags...>>);
+
+    using TagsList = type_helper::TypeList<Tags...>;
+    static constexpr std::size_t size{sizeof...(Tags)};
+};
+
+namespace dimension_helper
+{
+/// A reduced ratio, the structural counterpart of std::ratio.
+struct Ratio
+{
+    std::intmax_t num{1};
+    std::intmax_t den{1};
+
+    friend constexpr bool operator==(const Ratio&, const Ratio&) = default;
+};
+
+constexpr Ratio reduce(const std::intmax_t num, const std::intmax_t den)
+{
+    const std::intmax_t gcd{std::gcd(num, den)};
+    const std::intmax_t sign{den < 0 ? -1 : 1};
+    return {sign * num / gcd, sign * den / gcd};
+}
+
+constexpr Ratio multiply(const Ratio lhs, const Ratio rhs)
+{
+    const std::intmax_t gcd_1{std::gcd(lhs.num, rhs.den)};
+    const std::intmax_t gcd_2{std::gcd(rhs.num, lhs.den)};
+    return reduce((lhs.num / gcd_1) * (rhs.num / gcd_2), (lhs.den / gcd_2) * (rhs.den / gcd_1));
+}
+
+constexpr Ratio divide(const Ratio lhs, const Ratio rhs)
+{
+    return multiply(lhs, {rhs.den, rhs.num});
+}
+
+constexpr Ratio pow(const Ratio base, const std::int32_t exp)
+{
+    Ratio ret{};
+    for (std::int32_t i{0}; i < (exp < 0 ? -exp : exp); ++i)
+    {
+        ret = multiply(ret, base);
+    }
+    return exp < 0 ? Ratio{ret.den, ret.num} : ret;
+}
+
+/// The same as number_helper::ratio_gcd.
+constexpr Ratio gcd(const Ratio lhs, const Ratio rhs)
+{
+    return reduce(std::gcd(lhs.num, rhs.num), std::lcm(lhs.den, rhs.den));
+}
+
+/**
+ * The exponent and the period of each dimension of a DimensionSystem.
+ * @details The period of a dimension with exponent 0 is 1, so that a unit has one representation.
+ */
+template <std::size_t N>
+struct Dimension
+{
+    std::array<std::int32_t, N> exp{};
+    std::array<Ratio, N> period{};
+
+    friend constexpr bool operator==(const Dimension&, const Dimension&) = default;
+
+    /// The period of the whole unit, the counterpart of CompoundUnit::Period.
+    constexpr Ratio totalPeriod() const
+    {
+        Ratio ret{};
+        for (std::size_t i{0}; i < N; ++i)
+        {
+            ret = multiply(ret, pow(period[i], exp[i]));
+        }
+        return ret;
+    }
+
+    constexpr bool isDimensionless() const
+    {
+        for (const std::int32_t e : exp)
+        {
+            if (e != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr bool isCanonical() const
+    {
+        for (std::size_t i{0}; i < N; ++i)
+        {
+            if (period[i].num <= 0 || (exp[i] == 0 && period[i] != Ratio{}))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr Dimension inverse() const
+    {
+        Dimension ret{*this};
+        for (std::int32_t& e : ret.exp)
+        {
+            e = -e;
+        }
+        return ret;
+    }
+};
+
+/// The dimension of a product, and the factor of the product of the counts.
+template <std::size_t N>
+struct Product
+{
+    Dimension<N> dimension;
+    Ratio scaling;
+};
+
+/**
+ * Multiply two dimensions, element-wise.
+ * @details The same algebra as signature_helper::computeMultiplicationSignatures_impl and
+ *          compound_unit_helper::determineScalingRatio, in a single constexpr loop: the periods of
+ *          a dimension of both operands are reduced to their gcd, which scales the product.
+ */
+template <std::size_t N>
+constexpr Product<N> multiply(const Dimension<N>& lhs, const Dimension<N>& rhs)
+{
+    Product<N> ret{};
+    for (std::size_t i{0}; i < N; ++i)
+    {
+        ret.dimension.exp[i] = lhs.exp[i] + rhs.exp[i];
+        if (lhs.exp[i] != 0 && rhs.exp[i] != 0)
+        {
+            const Ratio common{gcd(lhs.period[i], rhs.period[i])};
+            ret.scaling = multiply(ret.scaling, pow(divide(lhs.period[i], common), lhs.exp[i]));
+            ret.scaling = multiply(ret.scaling, pow(divide(rhs.period[i], common), rhs.exp[i]));
+            ret.dimension.period[i] = ret.dimension.exp[i] == 0 ? Ratio{} : common;
+        }
+        else
+        {
+            ret.dimension.period[i] = lhs.exp[i] != 0 ? lhs.period[i] : rhs.period[i];
+        }
+    }
+    return ret;
+}
+
+/// Whether all the tags of a compound unit are in a dimension system.
+template <class System, CompoundUnitConcept CU>
+constexpr bool is_in_system_v{
+    []<number_helper::RepConcept Rep, UnitSignatureConcept... Signatures>(
+        CompoundUnit<Rep, Signatures...>) {
+        return (System::TagsList::template has_type<typename Signatures::Tag> && ...);
+    }(CU{})};
+
+/// The dimension of a compound unit in a system, all its tags must be in the system.
+template <class System, number_helper::RepConcept Rep, UnitSignatureConcept... Signatures>
+consteval Dimension<System::size> dimensionOf(CompoundUnit<Rep, Signatures...>)
+{
+    static_assert((System::TagsList::template has_type<typename Signatures::Tag> && ...),
+                  "The tags of the compound unit shall be in the dimension system.");
+    // Assign every element, GCC 12 does not treat an implicitly initialized element of a template
+    // argument as equivalent to an assigned one, e.g. the dimensions computed by multiply().
+    Dimension<System::size> ret{};
+    for (std::size_t i{0}; i < System::size; ++i)
+    {
+        ret.exp[i] = 0;
+        ret.period[i] = Ratio{1, 1};
+    }
+    (
+        [&ret] {
+            constexpr std::size_t i{
+                *type_helper::pos_of_type_v<typename System::TagsList, typename Signatures::Tag>};
+            ret.exp[i] = Signatures::Exp;
+            ret.period[i] = reduce(Signatures::Period::num, Signatures::Period::den);
+        }(),
+        ...);
+    return ret;
+}
+
+/// The compound unit of the dimension, with a signature per non-zero exponent.
+template <number_helper::RepConcept Rep, class System, Dimension<System::size> Dim>
+consteval CompoundUnitConcept auto compoundUnitOf()
+{
+    static_assert(!Dim.isDimensionless());
+    return []<std::size_t... Is>(std::index_sequence<Is...>) {
+        using Signatures = decltype(signature_helper::removeCancelledOutSignatures(
+            type_helper::TypeList<decltype([] {
+                if constexpr (Dim.exp[Is] != 0)
+                {
+                    return UnitSignature<std::ratio<Dim.period[Is].num, Dim.period[Is].den>,
+                                         Dim.exp[Is],
+                                         typename System::TagsList::template type_at<Is>>{};
+                }
+                else
+                {
+                    return signature_helper::NullSignature{};
+                }
+            }())...>{}));
+        return type_helper::make_specialization_t<
+            CompoundUnit, typename Signatures::template push_front_t<Rep>>{};
+    }(std::make_index_sequence<System::size>());
+}
+
+/// The type of compoundUnitOf(). A struct, since GCC 12 crashes on an alias of the decltype.
+template <number_helper::RepConcept Rep, class System, Dimension<System::size> Dim>
+struct compound_unit_of
+{
+    using type = decltype(compoundUnitOf<Rep, System, Dim>());
+};
+
+template <number_helper::RepConcept Rep, class System, Dimension<System::size> Dim>
+using compound_unit_of_t = typename compound_unit_of<Rep, System, Dim>::type;
+} // namespace dimension_helper
+
+/**
+ * Compound unit whose dimension is an array of exponents and periods over a fixed
+ * DimensionSystem, instead of a list of UnitSignatures.
+ * @details The unit algebra of the operators is element-wise arithmetic on the arrays, evaluated
+ *          in one constexpr step, instead of the TypeList unions and searches of CompoundUnit.
+ *          The arithmetic on the counts is the same as for the equivalent CompoundUnit.
+ *          A DimensionUnit is constructible from a castable CompoundUnit, and converts to one,
+ *          see to_dimension_unit_t and to_compound_unit_t.
+ * @tparam _Rep the underlying representation type.
+ * @tparam _System the DimensionSystem.
+ * @tparam _Dim the exponents and periods, at least one exponent must be non-zero.
+ */
+template <number_helper::RepConcept _Rep, class _System,
+          dimension_helper::Dimension<_System::size> _Dim>
+class DimensionUnit
+{
+    static_assert(!_Dim.isDimensionless(), "A unit shall have a dimension.");
+    static_assert(_Dim.isCanonical(), "The period of a dimension with exponent 0 shall be 1.");
+
+    /// The equivalent compound unit.
+    using Unit = dimension_helper::compound_unit_of_t<_Rep, _System, _Dim>;
+
+  public:
+    using Rep = _Rep;
+    using System = _System;
+    static constexpr dimension_helper::Dimension<_System::size> Dim{_Dim};
+    static constexpr dimension_helper::Ratio period{_Dim.totalPeriod()};
+    /// @brief The period of the compound unit.
+    using Period = std::ratio<period.num, period.den>;
+
+    /// @brief Constructors.
+    ///@{
+    explicit constexpr DimensionUnit() : count_{0} {}
+
+    explicit constexpr DimensionUnit(const _Rep count) : count_{count} {}
+
+    /// @brief Construct from a DimensionUnit of the same exponents. The conversions go through
+    ///        castAs of the equivalent compound units, so they are explicit in the strict mode
+    ///        unless they are the identity, and counted with CPU_STRONG_TYPE_INSTRUMENT.
+    template <number_helper::RepConcept _XRep, dimension_helper::Dimension<_System::size> _XDim>
+    requires(_XDim.exp == _Dim.exp)
+    constexpr explicit(compound_unit_helper::is_explicit_conversion_v<
+                       dimension_helper::compound_unit_of_t<_XRep, _System, _XDim>, Unit>)
+        DimensionUnit(const DimensionUnit<_XRep, _System, _XDim>& from)
+        : DimensionUnit{dimension_helper::compound_unit_of_t<_XRep, _System, _XDim>{from.count()}}
+    {}
+
+    /// @brief Construct from a castable CompoundUnit.
+    template <CompoundUnitConcept CU>
+    requires(dimension_helper::is_in_system_v<_System, CU> &&
+             dimension_helper::dimensionOf<_System>(CU{}).exp == _Dim.exp)
+    constexpr explicit(compound_unit_helper::is_explicit_conversion_v<CU, Unit>)
+        DimensionUnit(const CU& from)
+        : count_{compound_unit_helper::castAs<Unit>(from).count()}
+    {}
+    ///@}
+
+    /// @brief Convert to a castable CompoundUnit.
+    template <CompoundUnitConcept CU>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, Unit>)
+    constexpr explicit(compound_unit_helper::is_explicit_conversion_v<Unit, CU>)
+    operator CU() const
+    {
+        return compound_unit_helper::castAs<CU>(Unit{count_});
+    }
+
+    constexpr _Rep count() const { return count_; }
+
+    constexpr std::partial_ordering operator<=>(const DimensionUnit&) const = default;
+
+    /// @brief The count, public for DimensionUnit to be a structural type.
+    _Rep count_;
+
+};
+
+/// Concept for DimensionUnit.
+template <class T>
+concept DimensionUnitConcept = requires {
+    typename T::System;
+    requires std::same_as<T, DimensionUnit<typename T::Rep, typename T::System, T::Dim>>;
+};
+
+/// The DimensionUnit of a compound unit in a dimension system.
+template <class System, CompoundUnitConcept CU>
+using to_dimension_unit_t =
+    DimensionUnit<typename CU::Rep, System, dimension_helper::dimensionOf<System>(CU{})>;
+
+/// The CompoundUnit of a DimensionUnit.
+template <DimensionUnitConcept DU>
+using to_compound_unit_t =
+    dimension_helper::compound_unit_of_t<typename DU::Rep, typename DU::System, DU::Dim>;
+
+namespace dimension_helper
+{
+/// The DimensionUnit or, if dimensionless, the number of a product of counts.
+template <number_helper::RepConcept Rep, class System, Dimension<System::size> Dim>
+consteval auto productType()
+{
+    if constexpr (Dim.isDimensionless())
+    {
+        return Rep{};
+    }
+    else
+    {
+        return DimensionUnit<Rep, System, Dim>{};
+    }
+}
+
+template <DimensionUnitConcept L, DimensionUnitConcept R>
+using common_rep_t = std::common_type_t<number_helper::result_rep_t<typename L::Rep>,
+                                        number_helper::result_rep_t<typename R::Rep>>;
+} // namespace dimension_helper
+
+/// Operators of DimensionUnit, the same arithmetic as the ones of CompoundUnit.
+///@{
+template <DimensionUnitConcept L, DimensionUnitConcept R>
+requires(std::same_as<typename L::System, typename R::System>)
+constexpr auto operator*(const L& lhs, const R& rhs)
+{
+    constexpr dimension_helper::Product<L::System::size> product{
+        dimension_helper::multiply(L::Dim, R::Dim)};
+    using CommonRep = dimension_helper::common_rep_t<L, R>;
+    using ReturnType = decltype(dimension_helper::productType<CommonRep, typename L::System,
+                                                              product.dimension>());
+    const CommonRep count{static_cast<CommonRep>(number_helper::widen(lhs.count())) *
+                          static_cast<CommonRep>(number_helper::widen(rhs.count())) *
+                          product.scaling.num / product.scaling.den};
+    return ReturnType(count);
+}
+
+template <DimensionUnitConcept L, DimensionUnitConcept R>
+requires(std::same_as<typename L::System, typename R::System>)
+constexpr auto operator/(const L& lhs, const R& rhs)
+{
+    constexpr dimension_helper::Product<L::System::size> product{
+        dimension_helper::multiply(L::Dim, R::Dim.inverse())};
+    using CommonRep = dimension_helper::common_rep_t<L, R>;
+    using ReturnType = decltype(dimension_helper::productType<CommonRep, typename L::System,
+                                                              product.dimension>());
+    const CommonRep count{static_cast<CommonRep>(number_helper::widen(lhs.count())) *
+                          product.scaling.num /
+                          static_cast<CommonRep>(number_helper::widen(rhs.count())) /
+                          product.scaling.den};
+    return ReturnType(count);
+}
+
+template <DimensionUnitConcept L, number_helper::SignedNumberConcept Rhs>
+constexpr auto operator*(const L& lhs, const Rhs rhs)
+{
+    using CommonRep = std::common_type_t<number_helper::result_rep_t<typename L::Rep>, Rhs>;
+    return DimensionUnit<CommonRep, typename L::System, L::Dim>{static_cast<CommonRep>(
+        static_cast<CommonRep>(number_helper::widen(lhs.count())) * static_cast<CommonRep>(rhs))};
+}
+
+template <number_helper::SignedNumberConcept Lhs, DimensionUnitConcept R>
+constexpr auto operator*(const Lhs lhs, const R& rhs)
+{
+    return rhs * lhs;
+}
+
+template <DimensionUnitConcept L, number_helper::SignedNumberConcept Rhs>
+constexpr auto operator/(const L& lhs, const Rhs rhs)
+{
+    using CommonRep = std::common_type_t<number_helper::result_rep_t<typename L::Rep>, Rhs>;
+    return DimensionUnit<CommonRep, typename L::System, L::Dim>{static_cast<CommonRep>(
+        static_cast<CommonRep>(number_helper::widen(lhs.count())) / static_cast<CommonRep>(rhs))};
+}
+
+template <DimensionUnitConcept T>
+constexpr auto operator-(const T& operand)
+{
+    using ResultRep = number_helper::result_rep_t<typename T::Rep>;
+    return DimensionUnit<ResultRep, typename T::System, T::Dim>{
+        static_cast<ResultRep>(-number_helper::widen(operand.count()))};
+}
+
+/// The sum is in the unit of the operand with the smaller period, as for CompoundUnit.
+template <DimensionUnitConcept L, DimensionUnitConcept R>
+requires(std::same_as<typename L::System, typename R::System> && L::Dim.exp == R::Dim.exp)
+constexpr auto operator+(const L& lhs, const R& rhs)
+{
+    constexpr auto dim{std::ratio_less_equal_v<typename L::Period, typename R::Period> ? L::Dim
+                                                                                      : R::Dim};
+    using ReturnType =
+        DimensionUnit<dimension_helper::common_rep_t<L, R>, typename L::System, dim>;
+    using Rep = typename ReturnType::Rep;
+    return ReturnType{static_cast<Rep>(ReturnType{lhs}.count() + ReturnType{rhs}.count())};
+}
+
+template <DimensionUnitConcept L, DimensionUnitConcept R>
+requires(std::same_as<typename L::System, typename R::System> && L::Dim.exp == R::Dim.exp)
+constexpr auto operator-(const L& lhs, const R& rhs)
+{
+    return lhs + (-rhs);
+}
+
+template <DimensionUnitConcept L, DimensionUnitConcept R>
+requires(std::same_as<typename L::System, typename R::System> && L::Dim.exp == R::Dim.exp &&
+         !std::same_as<L, R>)
+constexpr std::partial_ordering operator<=>(const L& lhs, const R& rhs)
+{
+    constexpr auto dim{std::ratio_less_equal_v<typename L::Period, typename R::Period> ? L::Dim
+                                                                                      : R::Dim};
+    using CommonType =
+        DimensionUnit<dimension_helper::common_rep_t<L, R>, typename L::System, dim>;
+    return CommonType{lhs}.count() <=> CommonType{rhs}.count();
+}
+
+template <DimensionUnitConcept L, DimensionUnitConcept R>
+requires(std::same_as<typename L::System, typename R::System> && L::Dim.exp == R::Dim.exp &&
+         !std::same_as<L, R>)
+constexpr bool operator==(const L& lhs, const R& rhs)
+{
+    return (lhs <=> rhs) == 0;
+}
+///@}
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_DIMENSION_UNIT_H_
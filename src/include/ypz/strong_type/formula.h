@@ -0,0 +1,579 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_FORMULA_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_FORMULA_H_
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/type.h"
+
+namespace cpu
+{
+/**
+ * Runtime description of a compound unit, i.e. its dimension and the value of one count.
+ * @details The dimension is the list of tags with their exponents, a tag is identified by the
+ *          hash of its type name. E.g. DynamicUnit::of<KmPerHour>() has the dimension
+ *          {LengthTag: 1, TimeTag: -1} and the scale 1000 / 3600.
+ */
+class DynamicUnit
+{
+  public:
+    /// @brief Exponent of one tag.
+    struct Factor
+    {
+        std::uint64_t tag;
+        std::int32_t exp;
+
+        bool operator==(const Factor&) const = default;
+    };
+
+    /// @brief Construct a dimensionless unit of scale 1.
+    DynamicUnit() = default;
+
+    /// @brief The runtime description of a compound unit.
+    template <CompoundUnitConcept CU>
+    static DynamicUnit of()
+    {
+        DynamicUnit ret{};
+        ret.scale_ = static_cast<double>(CU::Period::num) / static_cast<double>(CU::Period::den);
+        [&ret]<UnitSignatureConcept... Signatures>(type_helper::TypeList<Signatures...>) {
+            (ret.factors_.push_back(
+                 {type_helper::fnv1a(type_helper::typeName<typename Signatures::Tag>()),
+                  Signatures::Exp}),
+             ...);
+        }(typename CU::Signatures{});
+        ret.normalize();
+        return ret;
+    }
+
+    /// @brief The value of one count, relative to the unit of period 1 of the same dimension.
+    double scale() const { return scale_; }
+
+    /// @brief Whether the unit has no dimension.
+    bool isDimensionless() const { return factors_.empty(); }
+
+    /// @brief Whether two units have the same dimension, i.e. they are castable.
+    bool hasSameDimension(const DynamicUnit& other) const { return factors_ == other.factors_; }
+
+    /// @brief The product and the quotient of two units.
+    ///@{
+    friend DynamicUnit operator*(const DynamicUnit& lhs, const DynamicUnit& rhs)
+    {
+        return combine(lhs, rhs, 1);
+    }
+
+    friend DynamicUnit operator/(const DynamicUnit& lhs, const DynamicUnit& rhs)
+    {
+        return combine(lhs, rhs, -1);
+    }
+    ///@}
+
+  private:
+    static DynamicUnit combine(const DynamicUnit& lhs, const DynamicUnit& rhs,
+                               const std::int32_t sign)
+    {
+        DynamicUnit ret{lhs};
+        ret.scale_ = sign > 0 ? lhs.scale_ * rhs.scale_ : lhs.scale_ / rhs.scale_;
+        for (const Factor& factor : rhs.factors_)
+        {
+            ret.factors_.push_back({factor.tag, sign * factor.exp});
+        }
+        ret.normalize();
+        return ret;
+    }
+
+    /// Sort the factors by tag, merge the factors of the same tag and drop the zero exponents.
+    void normalize()
+    {
+        std::sort(factors_.begin(), factors_.end(),
+                  [](const Factor& lhs, const Factor& rhs) { return lhs.tag < rhs.tag; });
+        std::vector<Factor> merged{};
+        for (const Factor& factor : factors_)
+        {
+            if (!merged.empty() && merged.back().tag == factor.tag)
+            {
+                merged.back().exp += factor.exp;
+            }
+            else
+            {
+                merged.push_back(factor);
+            }
+        }
+        std::erase_if(merged, [](const Factor& factor) { return factor.exp == 0; });
+        factors_ = std::move(merged);
+    }
+
+    double scale_{1.0};
+    std::vector<Factor> factors_{};
+};
+
+/// Named input of a formula, whose values are counts of `unit`.
+struct FormulaInput
+{
+    std::string_view name;
+    DynamicUnit unit;
+};
+
+namespace formula_helper
+{
+enum class OpCode : std::uint8_t
+{
+    Load,     ///< Push input[input] * constant.
+    Constant, ///< Push constant.
+    Scale,    ///< top *= constant.
+    Negate,   ///< top = -top.
+    Add,      ///< Pop rhs, top += rhs.
+    Subtract, ///< Pop rhs, top -= rhs.
+    Multiply, ///< Pop rhs, top *= rhs.
+    Divide,   ///< Pop rhs, top /= rhs.
+};
+
+struct Instruction
+{
+    OpCode op;
+    std::uint32_t input;
+    double constant;
+};
+
+/**
+ * Recursive descent parser, which checks the dimensions and emits the bytecode in one pass.
+ * @details Grammar:
+ *              expr    := term (('+' | '-') term)*
+ *              term    := unary (('*' | '/') unary)*
+ *              unary   := '-' unary | primary
+ *              primary := number | identifier | '(' expr ')'
+ *          The value of each sub-expression is tracked in the scale of its unit, the scaling of
+ *          castable operands of + and - is folded into the preceding Load or Scale, and constant
+ *          sub-expressions are folded.
+ */
+class Compiler
+{
+  public:
+    /// The unit of a compiled sub-expression, and its value if it is a constant.
+    struct Operand
+    {
+        DynamicUnit unit;
+        std::optional<double> constant;
+    };
+
+    Compiler(const std::string_view source, const std::span<const FormulaInput> inputs)
+        : source_{source}, inputs_{inputs}
+    {}
+
+    /// Compile the whole source, std::nullopt on a syntax or dimension error.
+    std::optional<Operand> compile()
+    {
+        std::optional<Operand> ret{expr()};
+        skipSpaces();
+        if (!ret || pos_ != source_.size())
+        {
+            return std::nullopt;
+        }
+        return ret;
+    }
+
+    std::vector<Instruction>& code() { return code_; }
+
+    /// Emit top *= factor, folded into the preceding Load or Scale.
+    void scale(const double factor)
+    {
+        if (factor == 1.0)
+        {
+            return;
+        }
+        if (!code_.empty() && (code_.back().op == OpCode::Load || code_.back().op == OpCode::Scale))
+        {
+            code_.back().constant *= factor;
+            return;
+        }
+        code_.push_back({OpCode::Scale, 0, factor});
+    }
+
+  private:
+    std::optional<Operand> expr()
+    {
+        std::optional<Operand> lhs{term()};
+        while (lhs && (peek('+') || peek('-')))
+        {
+            const bool is_add{source_[pos_++] == '+'};
+            const std::optional<Operand> rhs{term()};
+            if (!rhs || !lhs->unit.hasSameDimension(rhs->unit))
+            {
+                return std::nullopt;
+            }
+            lhs = additive(*lhs, *rhs, is_add);
+        }
+        return lhs;
+    }
+
+    std::optional<Operand> term()
+    {
+        std::optional<Operand> lhs{unary()};
+        while (lhs && (peek('*') || peek('/')))
+        {
+            const bool is_multiply{source_[pos_++] == '*'};
+            const std::size_t rhs_begin{code_.size()};
+            const std::optional<Operand> rhs{unary()};
+            if (!rhs)
+            {
+                return std::nullopt;
+            }
+            lhs = multiplicative(*lhs, *rhs, rhs_begin, is_multiply);
+        }
+        return lhs;
+    }
+
+    std::optional<Operand> unary()
+    {
+        if (!peek('-'))
+        {
+            return primary();
+        }
+        ++pos_;
+        std::optional<Operand> operand{unary()};
+        if (operand && operand->constant)
+        {
+            operand->constant = -*operand->constant;
+        }
+        else if (operand)
+        {
+            negate();
+        }
+        return operand;
+    }
+
+    std::optional<Operand> primary()
+    {
+        if (peek('('))
+        {
+            ++pos_;
+            std::optional<Operand> ret{expr()};
+            if (!ret || !peek(')'))
+            {
+                return std::nullopt;
+            }
+            ++pos_;
+            return ret;
+        }
+
+        if (pos_ < source_.size() && isIdentifierStart(source_[pos_]))
+        {
+            const std::size_t begin{pos_};
+            while (pos_ < source_.size() && isIdentifierChar(source_[pos_]))
+            {
+                ++pos_;
+            }
+            const std::string_view name{source_.substr(begin, pos_ - begin)};
+            const auto input =
+                std::find_if(inputs_.begin(), inputs_.end(),
+                             [name](const FormulaInput& in) { return in.name == name; });
+            if (input == inputs_.end())
+            {
+                return std::nullopt;
+            }
+            code_.push_back(
+                {OpCode::Load, static_cast<std::uint32_t>(input - inputs_.begin()), 1.0});
+            return Operand{input->unit, std::nullopt};
+        }
+
+        double value{};
+        const char* const begin{source_.data() + pos_};
+        const auto [end, ec] = std::from_chars(begin, source_.data() + source_.size(), value);
+        if (ec != std::errc{})
+        {
+            return std::nullopt;
+        }
+        pos_ += static_cast<std::size_t>(end - begin);
+        return Operand{DynamicUnit{}, value};
+    }
+
+    /// lhs + rhs or lhs - rhs, the result is in the scale of the non-constant operand.
+    Operand additive(const Operand& lhs, const Operand& rhs, const bool is_add)
+    {
+        const double sign{is_add ? 1.0 : -1.0};
+        if (lhs.constant && rhs.constant)
+        {
+            return {lhs.unit, *lhs.constant + sign * *rhs.constant * rhs.unit.scale() /
+                                                  lhs.unit.scale()};
+        }
+        if (lhs.constant)
+        { // The code of rhs is on top, push lhs in the scale of rhs after it.
+            if (!is_add)
+            {
+                negate();
+            }
+            code_.push_back(
+                {OpCode::Constant, 0, *lhs.constant * lhs.unit.scale() / rhs.unit.scale()});
+            code_.push_back({OpCode::Add, 0, 0.0});
+            return {rhs.unit, std::nullopt};
+        }
+        if (rhs.constant)
+        {
+            code_.push_back(
+                {OpCode::Constant, 0, sign * *rhs.constant * rhs.unit.scale() / lhs.unit.scale()});
+            code_.push_back({OpCode::Add, 0, 0.0});
+            return {lhs.unit, std::nullopt};
+        }
+        scale(rhs.unit.scale() / lhs.unit.scale());
+        code_.push_back({is_add ? OpCode::Add : OpCode::Subtract, 0, 0.0});
+        return {lhs.unit, std::nullopt};
+    }
+
+    /// lhs * rhs or lhs / rhs, the scales multiply and need no code.
+    Operand multiplicative(const Operand& lhs, const Operand& rhs, const std::size_t rhs_begin,
+                           const bool is_multiply)
+    {
+        const DynamicUnit unit{is_multiply ? lhs.unit * rhs.unit : lhs.unit / rhs.unit};
+        if (lhs.constant && rhs.constant)
+        {
+            return {unit, is_multiply ? *lhs.constant * *rhs.constant
+                                      : *lhs.constant / *rhs.constant};
+        }
+        if (rhs.constant)
+        {
+            scale(is_multiply ? *rhs.constant : 1.0 / *rhs.constant);
+            return {unit, std::nullopt};
+        }
+        if (lhs.constant && is_multiply)
+        {
+            scale(*lhs.constant);
+            return {unit, std::nullopt};
+        }
+        if (lhs.constant)
+        { // c / rhs, push c before the code of rhs.
+            code_.insert(code_.begin() + static_cast<std::ptrdiff_t>(rhs_begin),
+                         {OpCode::Constant, 0, *lhs.constant});
+        }
+        code_.push_back({is_multiply ? OpCode::Multiply : OpCode::Divide, 0, 0.0});
+        return {unit, std::nullopt};
+    }
+
+    void negate()
+    {
+        if (!code_.empty() && (code_.back().op == OpCode::Load || code_.back().op == OpCode::Scale))
+        {
+            code_.back().constant = -code_.back().constant;
+            return;
+        }
+        code_.push_back({OpCode::Negate, 0, 0.0});
+    }
+
+    void skipSpaces()
+    {
+        while (pos_ < source_.size() && (source_[pos_] == ' ' || source_[pos_] == '\t'))
+        {
+            ++pos_;
+        }
+    }
+
+    bool peek(const char c)
+    {
+        skipSpaces();
+        return pos_ < source_.size() && source_[pos_] == c;
+    }
+
+    static bool isIdentifierStart(const char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+    }
+
+    static bool isIdentifierChar(const char c)
+    {
+        return isIdentifierStart(c) || (c >= '0' && c <= '9');
+    }
+
+    std::string_view source_;
+    std::span<const FormulaInput> inputs_;
+    std::size_t pos_{0};
+    std::vector<Instruction> code_{};
+};
+} // namespace formula_helper
+
+/**
+ * Formula over named inputs, compiled at runtime to a bytecode.
+ * @details E.g. Formula::compile("distance / duration", inputs, DynamicUnit::of<KmPerHour>())
+ *          checks that the formula has the dimension of the output, and folds the period
+ *          scaling of the inputs and the output into the constants of the bytecode.
+ *          The bytecode is evaluated a block of samples at a time, every instruction is a
+ *          branch-free loop over the block, so the interpretation cost is amortized over the
+ *          block and the inner loops are vectorizable.
+ */
+class Formula
+{
+  public:
+    /// @brief The number of samples evaluated by each instruction at a time.
+    static constexpr std::size_t kBlockSize{256};
+
+    /**
+     * Compile a formula.
+     * @param source the formula, e.g. "(end - begin) / duration * 2".
+     * @param inputs the names and the units of the inputs.
+     * @param output the unit of the result.
+     * @return the formula, or std::nullopt on a syntax error, an unknown input, a sum of
+     *         different dimensions, or a result whose dimension is not the one of the output.
+     */
+    static std::optional<Formula> compile(const std::string_view source,
+                                          const std::span<const FormulaInput> inputs,
+                                          const DynamicUnit& output)
+    {
+        formula_helper::Compiler compiler{source, inputs};
+        const std::optional<formula_helper::Compiler::Operand> result{compiler.compile()};
+        if (!result || !result->unit.hasSameDimension(output))
+        {
+            return std::nullopt;
+        }
+        const double factor{result->unit.scale() / output.scale()};
+        if (result->constant)
+        {
+            compiler.code().push_back(
+                {formula_helper::OpCode::Constant, 0, *result->constant * factor});
+        }
+        else
+        {
+            compiler.scale(factor);
+        }
+
+        Formula ret{};
+        ret.code_ = std::move(compiler.code());
+        std::ptrdiff_t depth{0};
+        for (const formula_helper::Instruction& instruction : ret.code_)
+        {
+            depth += stackDelta(instruction.op);
+            ret.max_depth_ = std::max(ret.max_depth_, static_cast<std::size_t>(depth));
+        }
+        return ret;
+    }
+
+    /// @brief The bytecode.
+    std::span<const formula_helper::Instruction> bytecode() const { return code_; }
+
+    /**
+     * Evaluate the formula for every sample.
+     * @param columns the counts of each input, in the order of the inputs at compilation.
+     * @param out the counts of the output.
+     * @pre columns.size() equals the number of inputs, and every column has at least
+     *      out.size() counts.
+     */
+    void evaluate(const std::span<const std::span<const double>> columns,
+                  const std::span<double> out) const
+    {
+        std::vector<double> stack(max_depth_ * kBlockSize);
+        for (std::size_t begin{0}; begin < out.size(); begin += kBlockSize)
+        {
+            const std::size_t size{std::min(kBlockSize, out.size() - begin)};
+            evaluateBlock(columns, begin, size, stack.data());
+            std::copy_n(stack.data(), size, out.data() + begin);
+        }
+    }
+
+  private:
+    Formula() = default;
+
+    /// The change of the stack depth by an instruction.
+    static std::ptrdiff_t stackDelta(const formula_helper::OpCode op)
+    {
+        using formula_helper::OpCode;
+        switch (op)
+        {
+        case OpCode::Load:
+        case OpCode::Constant:
+            return 1;
+        case OpCode::Scale:
+        case OpCode::Negate:
+            return 0;
+        default:
+            return -1;
+        }
+    }
+
+    /// Evaluate a block of samples, the result is left in the bottom slot of the stack.
+    void evaluateBlock(const std::span<const std::span<const double>> columns,
+                       const std::size_t begin, const std::size_t size, double* const stack) const
+    {
+        using formula_helper::OpCode;
+        std::size_t depth{0};
+        for (const formula_helper::Instruction& instruction : code_)
+        {
+            const double constant{instruction.constant};
+            switch (instruction.op)
+            {
+            case OpCode::Load: {
+                double* const top{stack + kBlockSize * depth++};
+                const double* const in{columns[instruction.input].data() + begin};
+                for (std::size_t i{0}; i < size; ++i)
+                {
+                    top[i] = in[i] * constant;
+                }
+                break;
+            }
+            case OpCode::Constant:
+                std::fill_n(stack + kBlockSize * depth++, size, constant);
+                break;
+            case OpCode::Scale:
+                apply(stack + kBlockSize * (depth - 1), size, [constant](double x) {
+                    return x * constant;
+                });
+                break;
+            case OpCode::Negate:
+                apply(stack + kBlockSize * (depth - 1), size, [](double x) { return -x; });
+                break;
+            case OpCode::Add:
+                --depth;
+                apply(stack + kBlockSize * (depth - 1), size, std::plus<>{});
+                break;
+            case OpCode::Subtract:
+                --depth;
+                apply(stack + kBlockSize * (depth - 1), size, std::minus<>{});
+                break;
+            case OpCode::Multiply:
+                --depth;
+                apply(stack + kBlockSize * (depth - 1), size, std::multiplies<>{});
+                break;
+            case OpCode::Divide:
+                --depth;
+                apply(stack + kBlockSize * (depth - 1), size, std::divides<>{});
+                break;
+            }
+        }
+    }
+
+    /// top[i] = op(top[i]).
+    template <class Op>
+    requires(std::is_invocable_v<Op, double>)
+    static void apply(double* const top, const std::size_t size, Op op)
+    {
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            top[i] = op(top[i]);
+        }
+    }
+
+    /// top[i] = op(top[i], rhs[i]), where rhs is the popped slot above top.
+    template <class Op>
+    requires(std::is_invocable_v<Op, double, double>)
+    static void apply(double* const top, const std::size_t size, Op op)
+    {
+        const double* const rhs{top + kBlockSize};
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            top[i] = op(top[i], rhs[i]);
+        }
+    }
+
+    std::size_t max_depth_{0};
+    std::vector<formula_helper::Instruction> code_{};
+};
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_FORMULA_H_
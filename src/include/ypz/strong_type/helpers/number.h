@@ -1,8 +1,14 @@
 #ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_HELPERS_NUMBER_H_
 #define SRC_INCLUDE_YPZ_STRONG_TYPE_HELPERS_NUMBER_H_
 
+#include <concepts>
+#include <cstdint>
 #include <numeric>
 #include <ratio>
+#include <type_traits>
+#if __has_include(<stdfloat>)
+#include <stdfloat>
+#endif
 
 namespace cpu::number_helper
 {
@@ -17,11 +23,126 @@ struct is_std_ratio<std::ratio<_Num, _Den>> : std::true_type
 template <typename T>
 concept RatioConcept = is_std_ratio<T>::value;
 
+#if defined(__SIZEOF_INT128__)
+/// 128-bit signed integer, e.g. for wide accumulation of integer counts.
+__extension__ typedef __int128 int128_t;
+
+template <typename T>
+concept Int128Concept = std::same_as<std::remove_cv_t<T>, int128_t>;
+#else
+template <typename T>
+concept Int128Concept = false;
+#endif
+
 template <typename T>
-concept SignedNumberConcept = std::signed_integral<T> || std::floating_point<T>;
+concept SignedNumberConcept = std::signed_integral<T> || std::floating_point<T> || Int128Concept<T>;
 
 template <typename T>
-concept NumberConcept = std::integral<T> || std::floating_point<T>;
+concept NumberConcept = std::integral<T> || std::floating_point<T> || Int128Concept<T>;
+
+/**
+ * Traits of a representation type that may be used as the Rep of a compound unit.
+ * @details A rep type is either a built-in signed number, or a storage-only type (e.g. a
+ *          half-precision float) that specializes this struct with
+ *              * compute_type: the signed number type the arithmetic is carried out in.
+ *              * widen(rep): convert a rep value to compute_type.
+ *              * narrow(number): convert a number back to the rep type.
+ *          For built-in numbers the compute type is the promoted type, i.e. the type the
+ *          arithmetic is carried out in anyway.
+ */
+///@{
+template <typename T>
+struct rep_traits
+{};
+
+template <SignedNumberConcept T>
+struct rep_traits<T>
+{
+    using compute_type = decltype(+T{});
+
+    static constexpr compute_type widen(const T value) { return value; }
+
+    template <NumberConcept U>
+    static constexpr T narrow(const U value)
+    {
+        return static_cast<T>(value);
+    }
+};
+
+#if defined(__STDCPP_FLOAT16_T__)
+template <>
+struct rep_traits<std::float16_t>
+{
+    using compute_type = float;
+
+    static constexpr compute_type widen(const std::float16_t value) { return value; }
+
+    template <NumberConcept U>
+    static constexpr std::float16_t narrow(const U value)
+    {
+        return static_cast<std::float16_t>(value);
+    }
+};
+#endif
+
+#if defined(__STDCPP_BFLOAT16_T__)
+template <>
+struct rep_traits<std::bfloat16_t>
+{
+    using compute_type = float;
+
+    static constexpr compute_type widen(const std::bfloat16_t value) { return value; }
+
+    template <NumberConcept U>
+    static constexpr std::bfloat16_t narrow(const U value)
+    {
+        return static_cast<std::bfloat16_t>(value);
+    }
+};
+#endif
+///@}
+
+/// Concept for a storage-only rep, which widens to a signed number type for computation.
+template <typename T>
+concept StorageRepConcept = !SignedNumberConcept<T> && std::semiregular<T> && requires(T value) {
+    requires SignedNumberConcept<typename rep_traits<T>::compute_type>;
+    {
+        rep_traits<T>::widen(value)
+    } -> std::same_as<typename rep_traits<T>::compute_type>;
+    {
+        rep_traits<T>::template narrow<double>(0.0)
+    } -> std::same_as<T>;
+};
+
+/// Concept for the Rep of a compound unit.
+template <typename T>
+concept RepConcept = SignedNumberConcept<T> || StorageRepConcept<T>;
+
+/// The type in which the arithmetic of a Rep is carried out.
+template <RepConcept T>
+using compute_rep_t = typename rep_traits<T>::compute_type;
+
+/**
+ * The Rep of the result of the arithmetic operators on a Rep: the compute type of a storage rep,
+ * and the rep itself for a signed number, whose common type with another rep is the one of
+ * std::common_type_t, e.g. int16_t for two int16_t.
+ */
+template <RepConcept T>
+using result_rep_t = std::conditional_t<StorageRepConcept<T>, compute_rep_t<T>, T>;
+
+/// Convert a Rep value to its compute type.
+template <RepConcept T>
+constexpr compute_rep_t<T> widen(const T value)
+{
+    return rep_traits<T>::widen(value);
+}
+
+/// Convert a number to the Rep type.
+template <RepConcept T, NumberConcept U>
+constexpr T narrow(const U value)
+{
+    return rep_traits<T>::template narrow<U>(value);
+}
 
 template <std::int32_t base, std::int32_t exp>
 requires(exp >= 0)
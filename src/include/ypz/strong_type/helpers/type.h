@@ -1,8 +1,13 @@
 #ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_HELPERS_TYPE_H_
 #define SRC_INCLUDE_YPZ_STRONG_TYPE_HELPERS_TYPE_H_
 
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 
 namespace cpu
 {
@@ -122,6 +127,37 @@ template <template <typename...> class T, TypeListConcept TTypeList>
 using make_specialization_t = make_specialization<T, TTypeList>::type;
 ///@}
 
+/// The name of a type, e.g. "cpu::CompoundUnit<double, ...>".
+template <class T>
+consteval std::string_view typeName()
+{
+#if defined(_MSC_VER)
+    // E.g. "... __cdecl cpu::type_helper::typeName<int>(void)".
+    const std::string_view function{__FUNCSIG__};
+    const std::size_t begin{function.find("typeName<") + 9};
+    const std::size_t end{function.rfind(">(void)")};
+#else
+    // E.g. "... typeName() [with T = int; ...]" (GCC) or "... typeName() [T = int]" (Clang).
+    const std::string_view function{__PRETTY_FUNCTION__};
+    const std::size_t begin{function.find("T = ") + 4};
+    const std::size_t semicolon{function.find("; ", begin)};
+    const std::size_t end{semicolon == std::string_view::npos ? function.rfind(']') : semicolon};
+#endif
+    return function.substr(begin, end - begin);
+}
+
+/// FNV-1a hash of a string, or the continuation of `hash` over the string.
+consteval std::uint64_t fnv1a(const std::string_view str,
+                              std::uint64_t hash = 0xCBF2'9CE4'8422'2325ULL)
+{
+    for (const char c : str)
+    {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 0x0000'0100'0000'01B3ULL;
+    }
+    return hash;
+}
+
 } // namespace type_helper
 } // namespace cpu
 
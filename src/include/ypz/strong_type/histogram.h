@@ -0,0 +1,186 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_HISTOGRAM_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_HISTOGRAM_H_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "ypz/strong_type/compound_unit.h"
+
+namespace cpu
+{
+namespace histogram_helper
+{
+/**
+ * Log-linear bucket layout, in the manner of HdrHistogram.
+ * @details Counts below 2^SubBucketBits have one bucket each. Above that, each power of two
+ *          range [2^(SubBucketBits+g-1), 2^(SubBucketBits+g)) is split into 2^(SubBucketBits-1)
+ *          buckets of width 2^g, so the relative error of a bucket is at most
+ *          2^-(SubBucketBits-1).
+ */
+template <std::uint64_t HighestCount, unsigned SubBucketBits>
+requires(SubBucketBits >= 2 && SubBucketBits < 32 && HighestCount >= (1ULL << SubBucketBits))
+struct LogLinearLayout
+{
+    static constexpr std::uint64_t kSubBucketCount{1ULL << SubBucketBits};
+    static constexpr std::uint64_t kHalfSubBucketCount{kSubBucketCount / 2};
+
+    /// The number of buckets to cover [0, HighestCount].
+    static constexpr std::size_t kBucketCount{
+        kSubBucketCount +
+        (std::bit_width(HighestCount) - SubBucketBits) * kHalfSubBucketCount};
+
+    /// The index of the bucket of a count, the count must not exceed HighestCount.
+    static constexpr std::size_t indexOf(const std::uint64_t count)
+    {
+        if (count < kSubBucketCount)
+        {
+            return count;
+        }
+        const unsigned group{static_cast<unsigned>(std::bit_width(count)) - SubBucketBits};
+        return kSubBucketCount + (group - 1) * kHalfSubBucketCount +
+               ((count >> group) - kHalfSubBucketCount);
+    }
+
+    /// The lowest count of a bucket.
+    static constexpr std::uint64_t lowestOf(const std::size_t index)
+    {
+        if (index < kSubBucketCount)
+        {
+            return index;
+        }
+        const std::size_t offset{index - kSubBucketCount};
+        const std::size_t group{offset / kHalfSubBucketCount + 1};
+        return (offset % kHalfSubBucketCount + kHalfSubBucketCount) << group;
+    }
+
+    /// The highest count of a bucket.
+    static constexpr std::uint64_t highestOf(const std::size_t index)
+    {
+        return index + 1 < kBucketCount ? lowestOf(index + 1) - 1 : HighestCount;
+    }
+};
+} // namespace histogram_helper
+
+/**
+ * Log-linear histogram of compound units, e.g. of latencies.
+ * @details The buckets are defined at compile time in the period of CU. A value of any castable
+ *          unit is converted to CU with compile time constants and then bucketed in O(1).
+ *          Histograms of the same type can be merged, e.g. thread-local histograms into a
+ *          snapshot.
+ * @tparam CU the compound unit of the values, must have an integer Rep.
+ * @tparam HighestCount the highest trackable count in CU, larger values are clamped to it.
+ * @tparam SubBucketBits 2^SubBucketBits linear buckets for the smallest counts, which
+ *         determines the relative precision.
+ */
+template <CompoundUnitConcept CU, std::uint64_t HighestCount = (1ULL << 40),
+          unsigned SubBucketBits = 7>
+requires(std::integral<typename CU::Rep>)
+class Histogram
+{
+    using Layout = histogram_helper::LogLinearLayout<HighestCount, SubBucketBits>;
+
+  public:
+    using Unit = CU;
+
+    /// @brief The number of buckets.
+    static constexpr std::size_t bucket_count() { return Layout::kBucketCount; }
+
+    /// @brief Record a castable compound unit, negative values are recorded as zero.
+    template <CompoundUnitConcept X>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, X>)
+    void record(const X& value, const std::uint64_t times = 1)
+    {
+        const std::uint64_t count{clamp(CU{value}.count())};
+        buckets_[Layout::indexOf(count)] += times;
+        total_count_ += times;
+        min_ = std::min(min_, count);
+        max_ = std::max(max_, count);
+    }
+
+    /// @brief Merge the records of another histogram.
+    void merge(const Histogram& other)
+    {
+        for (std::size_t i{0}; i < bucket_count(); ++i)
+        {
+            buckets_[i] += other.buckets_[i];
+        }
+        total_count_ += other.total_count_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    /// @brief Clear all records.
+    void reset() { *this = Histogram{}; }
+
+    /// @brief The number of records.
+    std::uint64_t total_count() const { return total_count_; }
+
+    /// @brief The smallest recorded value, zero if empty.
+    CU min() const { return CU{static_cast<typename CU::Rep>(total_count_ == 0 ? 0 : min_)}; }
+
+    /// @brief The largest recorded value, zero if empty.
+    CU max() const { return CU{static_cast<typename CU::Rep>(max_)}; }
+
+    /**
+     * The value at a percentile, i.e. the highest value of the bucket which contains it.
+     * @param percentile in [0, 100].
+     * @return the value, zero if empty. It is within the relative precision of the histogram,
+     *         and clamped to [min(), max()].
+     */
+    CU percentile(const double percentile) const
+    {
+        if (total_count_ == 0)
+        {
+            return CU{0};
+        }
+        const double fraction{std::clamp(percentile, 0.0, 100.0) / 100.0};
+        const double exact_rank{std::ceil(fraction * static_cast<double>(total_count_))};
+        const std::uint64_t rank{
+            std::max<std::uint64_t>(1, static_cast<std::uint64_t>(exact_rank))};
+
+        std::uint64_t cumulative{0};
+        for (std::size_t i{Layout::indexOf(min_)}; i < bucket_count(); ++i)
+        {
+            cumulative += buckets_[i];
+            if (cumulative >= rank)
+            {
+                const std::uint64_t value{std::clamp(Layout::highestOf(i), min_, max_)};
+                return CU{static_cast<typename CU::Rep>(value)};
+            }
+        }
+        return max();
+    }
+
+    /// @brief The number of records in the bucket of a castable compound unit.
+    template <CompoundUnitConcept X>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, X>)
+    std::uint64_t count_at(const X& value) const
+    {
+        return buckets_[Layout::indexOf(clamp(CU{value}.count()))];
+    }
+
+  private:
+    static constexpr std::uint64_t clamp(const typename CU::Rep count)
+    {
+        if (count <= 0)
+        {
+            return 0;
+        }
+        return std::min(static_cast<std::uint64_t>(count), HighestCount);
+    }
+
+    std::array<std::uint64_t, Layout::kBucketCount> buckets_{};
+    std::uint64_t total_count_{0};
+    std::uint64_t min_{std::numeric_limits<std::uint64_t>::max()};
+    std::uint64_t max_{0};
+};
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_HISTOGRAM_H_
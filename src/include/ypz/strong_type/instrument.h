@@ -0,0 +1,184 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_INSTRUMENT_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_INSTRUMENT_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "ypz/strong_type/helpers/type.h"
+
+namespace cpu
+{
+/// The number of conversions from one compound unit to another.
+struct ConversionCount
+{
+    std::string_view from;
+    std::string_view to;
+    std::uint64_t count;
+};
+
+namespace instrument_helper
+{
+/**
+ * The conversion counters of all the threads.
+ * @details Every (from, to) pair gets an index on its first conversion. Each thread counts into
+ *          its own block, which only the owning thread writes, so an increment is a plain
+ *          relaxed load and store. The blocks are registered here for the report, and merged into
+ *          the retired counts when their thread exits.
+ */
+class Registry
+{
+  public:
+    struct ThreadCounters
+    {
+        ThreadCounters()
+        {
+            Registry& registry{instance()};
+            const std::lock_guard lock{registry.mutex_};
+            registry.threads_.push_back(this);
+        }
+
+        ~ThreadCounters()
+        {
+            Registry& registry{instance()};
+            const std::lock_guard lock{registry.mutex_};
+            for (std::size_t i{0}; i < counts.size(); ++i)
+            {
+                registry.retired_[i] += counts[i].load(std::memory_order_relaxed);
+            }
+            std::erase(registry.threads_, this);
+        }
+
+        ThreadCounters(const ThreadCounters&) = delete;
+        ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+        void increment(const std::size_t index)
+        {
+            if (index >= counts.size()) [[unlikely]]
+            {
+                const std::lock_guard lock{instance().mutex_};
+                counts.resize(index + 1);
+            }
+            std::atomic<std::uint64_t>& count{counts[index]};
+            count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        /// Grown under the mutex of the registry, a deque keeps the counters in place.
+        std::deque<std::atomic<std::uint64_t>> counts{};
+    };
+
+    static Registry& instance()
+    {
+        static Registry registry{};
+        return registry;
+    }
+
+    static ThreadCounters& threadCounters()
+    {
+        thread_local ThreadCounters counters{};
+        return counters;
+    }
+
+    /// @brief Add a (from, to) pair, return its index.
+    std::size_t add(const std::string_view from, const std::string_view to)
+    {
+        const std::lock_guard lock{mutex_};
+        pairs_.push_back({from, to, 0});
+        retired_.push_back(0);
+        return pairs_.size() - 1;
+    }
+
+    std::vector<ConversionCount> report()
+    {
+        const std::lock_guard lock{mutex_};
+        std::vector<ConversionCount> ret{pairs_};
+        for (std::size_t i{0}; i < ret.size(); ++i)
+        {
+            ret[i].count = retired_[i];
+        }
+        for (const ThreadCounters* const counters : threads_)
+        {
+            for (std::size_t i{0}; i < counters->counts.size(); ++i)
+            {
+                ret[i].count += counters->counts[i].load(std::memory_order_relaxed);
+            }
+        }
+        return ret;
+    }
+
+    void reset()
+    {
+        const std::lock_guard lock{mutex_};
+        std::fill(retired_.begin(), retired_.end(), 0);
+        for (ThreadCounters* const counters : threads_)
+        {
+            for (std::atomic<std::uint64_t>& count : counters->counts)
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+  private:
+    Registry() = default;
+
+    std::mutex mutex_{};
+    std::vector<ConversionCount> pairs_{};
+    std::vector<std::uint64_t> retired_{};
+    std::vector<ThreadCounters*> threads_{};
+};
+
+/// Count one conversion from From to To in the calling thread.
+template <class From, class To>
+void recordConversion()
+{
+    static const std::size_t index{
+        Registry::instance().add(type_helper::typeName<From>(), type_helper::typeName<To>())};
+    Registry::threadCounters().increment(index);
+}
+} // namespace instrument_helper
+
+/**
+ * The counted conversions of all the threads, the hottest first.
+ * @details The conversions are only counted when the translation units are compiled with
+ *          CPU_STRONG_TYPE_INSTRUMENT defined. Then every castAs which scales the count or
+ *          changes the rep, including the implicit ones of the converting constructor,
+ *          operator+/- and the comparisons, is counted per (from, to) pair in thread-local
+ *          counters. Without the macro, castAs contains no instrumentation at all.
+ * @param limit the maximal number of pairs to report.
+ */
+inline std::vector<ConversionCount> conversionReport(
+    const std::size_t limit = std::numeric_limits<std::size_t>::max())
+{
+    std::vector<ConversionCount> ret{instrument_helper::Registry::instance().report()};
+    std::erase_if(ret, [](const ConversionCount& pair) { return pair.count == 0; });
+    std::stable_sort(ret.begin(), ret.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.count > rhs.count;
+    });
+    ret.resize(std::min(ret.size(), limit));
+    return ret;
+}
+
+/// Write the hottest conversion pairs, one "count: from -> to" per line.
+inline void writeConversionReport(std::ostream& os,
+                                  const std::size_t limit = std::numeric_limits<std::size_t>::max())
+{
+    for (const ConversionCount& pair : conversionReport(limit))
+    {
+        os << pair.count << ": " << pair.from << " -> " << pair.to << '\n';
+    }
+}
+
+/// Reset the conversion counters of all the threads.
+inline void resetConversionCounts() { instrument_helper::Registry::instance().reset(); }
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_INSTRUMENT_H_
@@ -0,0 +1,134 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_INTEGRATE_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_INTEGRATE_H_
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <ratio>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "ypz/strong_type/compound_unit.h"
+
+namespace cpu
+{
+namespace integrate_helper
+{
+/// Concept for a step of State by Derivative * Time, i.e. State is castable from
+/// MultiplyUnit<Derivative, Time>, and State has a floating point rep.
+template <class State, class Derivative, class Time>
+concept IntegrableConcept =
+    CompoundUnitConcept<State> && CompoundUnitConcept<Derivative> && CompoundUnitConcept<Time> &&
+    std::floating_point<typename State::Rep> &&
+    CompoundUnitConcept<multiply_unit_t<Derivative, Time>> &&
+    compound_unit_helper::are_compound_units_castable_v<State, multiply_unit_t<Derivative, Time>>;
+
+/// The compile time factor from derivative.count() * dt.count() to the count of State.
+template <class State, class Derivative, class Time>
+requires IntegrableConcept<State, Derivative, Time>
+inline constexpr typename State::Rep step_factor_v{[] {
+    // The ratio which operator* applies to the product of the counts, then the cast to State.
+    using ProductRatio = decltype(compound_unit_helper::determineScalingRatio(
+        std::declval<Derivative>(), std::declval<Time>()));
+    using ScalingRatio = std::ratio_multiply<
+        ProductRatio, std::ratio_divide<typename multiply_unit_t<Derivative, Time>::Period,
+                                        typename State::Period>>;
+    using Rep = typename State::Rep;
+    return static_cast<Rep>(ScalingRatio::num) / static_cast<Rep>(ScalingRatio::den);
+}()};
+
+/// The step dt as a count of State per count of Derivative, i.e. the one multiplier of a kernel.
+template <class State, class Derivative, class Time>
+constexpr typename State::Rep stepOf(const Time dt)
+{
+    return step_factor_v<State, Derivative, Time> * static_cast<typename State::Rep>(dt.count());
+}
+} // namespace integrate_helper
+
+/**
+ * Integration kernels over structure of arrays of compound units.
+ * @details The units are checked at compile time, State = Derivative * Time through
+ *          MultiplyUnit, and all the period factors are folded with dt into one multiplier before
+ *          the loop. The loops are over the counts in the rep of State without any conversion, so
+ *          that the compiler vectorizes them like the loops over raw doubles, e.g. GCC from -O3 on.
+ * @pre The spans have the same size.
+ */
+///@{
+
+/// Explicit Euler: x += dxdt * dt.
+template <CompoundUnitConcept State, class Derivative, CompoundUnitConcept Time>
+requires integrate_helper::IntegrableConcept<State, std::remove_const_t<Derivative>, Time>
+void eulerStep(const std::span<State> x, const std::span<Derivative> dxdt, const Time dt)
+{
+    using Rep = typename State::Rep;
+    const Rep h{integrate_helper::stepOf<State, std::remove_const_t<Derivative>>(dt)};
+    for (std::size_t i{0}; i < x.size(); ++i)
+    {
+        x[i] = State{x[i].count() + h * static_cast<Rep>(dxdt[i].count())};
+    }
+}
+
+/**
+ * Velocity Verlet, for x'' = a(x).
+ * @details a holds the accelerations at x on entry, and the ones at the new x on return.
+ * @param accelerations called as accelerations(std::span<const Position>, a) to write a(x).
+ */
+template <CompoundUnitConcept Position, CompoundUnitConcept Velocity,
+          CompoundUnitConcept Acceleration, CompoundUnitConcept Time, class AccelerationFunction>
+requires(integrate_helper::IntegrableConcept<Position, Velocity, Time> &&
+         integrate_helper::IntegrableConcept<Velocity, Acceleration, Time> &&
+         std::invocable<AccelerationFunction&, std::span<const Position>,
+                        std::span<Acceleration>>)
+void velocityVerletStep(const std::span<Position> x, const std::span<Velocity> v,
+                        const std::span<Acceleration> a, const Time dt,
+                        AccelerationFunction&& accelerations)
+{
+    using PRep = typename Position::Rep;
+    using VRep = typename Velocity::Rep;
+    const PRep h{integrate_helper::stepOf<Position, Velocity>(dt)};
+    const VRep half_h{integrate_helper::stepOf<Velocity, Acceleration>(dt) / 2};
+    for (std::size_t i{0}; i < x.size(); ++i)
+    {
+        const VRep half_v{v[i].count() + half_h * static_cast<VRep>(a[i].count())};
+        v[i] = Velocity{half_v};
+        x[i] = Position{x[i].count() + h * static_cast<PRep>(half_v)};
+    }
+    std::invoke(accelerations, std::span<const Position>{x}, a);
+    for (std::size_t i{0}; i < x.size(); ++i)
+    {
+        v[i] = Velocity{v[i].count() + half_h * static_cast<VRep>(a[i].count())};
+    }
+}
+
+/**
+ * Classical Runge-Kutta of order 4, for x' = f(x) element-wise.
+ * @param f called as f(State) -> Derivative, inlined in the loop, so it should be cheap and
+ *          branchless to keep the loop vectorized.
+ */
+template <CompoundUnitConcept State, CompoundUnitConcept Time, class Function>
+requires(std::invocable<Function&, State> &&
+         integrate_helper::IntegrableConcept<State, std::invoke_result_t<Function&, State>, Time>)
+void rk4Step(const std::span<State> x, const Time dt, Function&& f)
+{
+    using Rep = typename State::Rep;
+    using Derivative = std::invoke_result_t<Function&, State>;
+    const Rep h{integrate_helper::stepOf<State, Derivative>(dt)};
+    const auto slope = [&f](const Rep count) {
+        return static_cast<Rep>(std::invoke(f, State{count}).count());
+    };
+    for (std::size_t i{0}; i < x.size(); ++i)
+    {
+        const Rep x0{x[i].count()};
+        const Rep k1{slope(x0)};
+        const Rep k2{slope(x0 + h / 2 * k1)};
+        const Rep k3{slope(x0 + h / 2 * k2)};
+        const Rep k4{slope(x0 + h * k3)};
+        x[i] = State{x0 + h / 6 * (k1 + 2 * k2 + 2 * k3 + k4)};
+    }
+}
+///@}
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_INTEGRATE_H_
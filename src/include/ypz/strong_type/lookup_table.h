@@ -0,0 +1,253 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_LOOKUP_TABLE_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_LOOKUP_TABLE_H_
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/constant.h"
+#include "ypz/strong_type/helpers/number.h"
+#include "ypz/strong_type/storage_rep.h"
+
+namespace cpu
+{
+namespace lookup_table_helper
+{
+/// The floating point type in which a lookup table interpolates.
+template <CompoundUnitConcept XUnit, CompoundUnitConcept YUnit>
+using interpolation_t = std::common_type_t<number_helper::compute_rep_t<typename XUnit::Rep>,
+                                           number_helper::compute_rep_t<typename YUnit::Rep>>;
+
+/// Tag of a lookup table whose grid is given point by point.
+struct NonUniformGrid
+{
+};
+
+/// Concept for the grid of a lookup table: NonUniformGrid, or the step of a uniform grid as a
+/// std::ratio of counts or as a Constant of a castable unit.
+template <class T>
+concept GridConcept =
+    std::same_as<T, NonUniformGrid> || number_helper::RatioConcept<T> || ConstantConcept<T>;
+
+/// The step of a uniform grid in counts of Abscissa.
+template <CompoundUnitConcept Abscissa, class Grid>
+constexpr typename Abscissa::Rep step_v{[] {
+    if constexpr (ConstantConcept<Grid>)
+    {
+        return Grid::template as<Abscissa>.count();
+    }
+    else
+    {
+        return static_cast<typename Abscissa::Rep>(Grid::num) /
+               static_cast<typename Abscissa::Rep>(Grid::den);
+    }
+}()};
+
+/**
+ * The batch interpolation on a uniform grid, over the counts.
+ * @details The position is clamped with arithmetic min/max and truncated to a 32-bit cell index,
+ *          and the samples of the cells are loaded by index, so that the loop has no control
+ *          flow. The pointers are restrict, since the loads by index cannot be versioned for
+ *          aliasing with the stores.
+ * @param cells the number of cells, i.e. of slopes, at most 2^31 - 1.
+ */
+template <CompoundUnitConcept X, CompoundUnitConcept Y, std::floating_point T>
+void interpolateUniform(const X* __restrict const xs, const std::size_t size, const T scale,
+                        const T offset, const T* __restrict const ys,
+                        const T* __restrict const slopes, const std::size_t cells,
+                        Y* __restrict const out)
+{
+    const T last{static_cast<T>(cells)};
+    const T last_cell{static_cast<T>(cells - 1)};
+    for (std::size_t i{0}; i < size; ++i)
+    {
+        T position{static_cast<T>(number_helper::widen(xs[i].count())) * scale - offset};
+        position = position > T{0} ? position : T{0};
+        position = position < last ? position : last;
+        const auto cell = static_cast<std::int32_t>(position < last_cell ? position : last_cell);
+        const T fraction{position - static_cast<T>(cell)};
+        out[i] = Y{number_helper::narrow<typename Y::Rep>(ys[cell] + slopes[cell] * fraction)};
+    }
+}
+} // namespace lookup_table_helper
+
+/**
+ * Piecewise linear lookup table of YUnit over XUnit, e.g. a calibration curve.
+ * @details The table is sampled either on a uniform grid whose step is known at compile time,
+ *          e.g. LookupTable<KmPerHour_double, Newton_double, std::ratio<5>> for one sample
+ *          every 5 km/h (or equivalently with the step Constant<KmPerHour{5}>), or on a
+ *          non-uniform grid, e.g. LookupTable<MeterPerSecond_double, Newton_double>. A query of
+ *          any castable X unit is converted once to XUnit, with compile time constants, and the
+ *          result is clamped to the first and last samples outside of the grid.
+ *          The interpolation is carried out in the common compute type of the reps, which must
+ *          be floating point.
+ * @tparam XUnit the compound unit of the abscissa.
+ * @tparam YUnit the compound unit of the ordinate.
+ * @tparam Grid the step of a uniform grid, in counts of XUnit as a std::ratio or as a
+ *         Constant of a castable unit, or NonUniformGrid.
+ */
+template <CompoundUnitConcept XUnit, CompoundUnitConcept YUnit,
+          lookup_table_helper::GridConcept Grid = lookup_table_helper::NonUniformGrid>
+requires(std::floating_point<lookup_table_helper::interpolation_t<XUnit, YUnit>>)
+class LookupTable
+{
+    using T = lookup_table_helper::interpolation_t<XUnit, YUnit>;
+
+    /// The abscissa in the interpolation type, a castable unit converts to it without rounding.
+    using Abscissa = StorageUnit<XUnit, T>;
+
+    static constexpr bool kIsUniform{!std::same_as<Grid, lookup_table_helper::NonUniformGrid>};
+
+  public:
+    /**
+     * Create a table on a non-uniform grid.
+     * @param xs the abscissas, strictly increasing.
+     * @param ys the ordinates, of the same size as xs.
+     * @return the table, or std::nullopt if there are less than 2 points, the sizes differ or
+     *         the abscissas are not strictly increasing.
+     */
+    static std::optional<LookupTable> fromPoints(const std::span<const XUnit> xs,
+                                                 const std::span<const YUnit> ys)
+    requires(!kIsUniform)
+    {
+        if (xs.size() < 2 || xs.size() != ys.size())
+        {
+            return std::nullopt;
+        }
+        LookupTable ret{};
+        ret.xs_.reserve(xs.size());
+        for (const XUnit& x : xs)
+        {
+            ret.xs_.push_back(number_helper::widen(x.count()));
+        }
+        if (std::adjacent_find(ret.xs_.begin(), ret.xs_.end(), std::greater_equal<T>{}) !=
+            ret.xs_.end())
+        {
+            return std::nullopt;
+        }
+        ret.setOrdinates(ys);
+        return ret;
+    }
+
+    /**
+     * Create a table on the uniform grid x0, x0 + Grid, x0 + 2 * Grid, ...
+     * @param x0 the first abscissa.
+     * @param ys the ordinates.
+     * @return the table, or std::nullopt if there are less than 2 samples.
+     */
+    template <CompoundUnitConcept X>
+    requires(kIsUniform && compound_unit_helper::are_compound_units_castable_v<XUnit, X>)
+    static std::optional<LookupTable> fromSamples(const X& x0, const std::span<const YUnit> ys)
+    {
+        if (ys.size() < 2)
+        {
+            return std::nullopt;
+        }
+        LookupTable ret{};
+        ret.xs_.push_back(Abscissa{x0}.count());
+        ret.setOrdinates(ys);
+        return ret;
+    }
+
+    /// @brief The number of samples.
+    std::size_t size() const { return ys_.size(); }
+
+    /// @brief Interpolate at a castable X unit.
+    template <CompoundUnitConcept X>
+    requires(compound_unit_helper::are_compound_units_castable_v<XUnit, X>)
+    YUnit operator()(const X& x) const
+    {
+        return YUnit{number_helper::narrow<typename YUnit::Rep>(interpolate(Abscissa{x}.count()))};
+    }
+
+    /**
+     * Interpolate a batch of castable X units.
+     * @details On a uniform grid the batch has its own loop over the counts, without control
+     *          flow, which vectorizes with gathers of the samples, e.g. GCC 12 at -O3
+     *          -march=haswell (its generic tuning of -march=x86-64-v3 emulates the gathers with
+     *          scalar loads). On a non-uniform grid each query is a binary search.
+     *          The elements of xs may be const, e.g. interpolate(std::span{xs}, std::span{out}).
+     * @pre out.size() >= xs.size(), and a uniform grid has less than 2^31 samples.
+     */
+    template <class X>
+    requires(CompoundUnitConcept<std::remove_const_t<X>> &&
+             compound_unit_helper::are_compound_units_castable_v<XUnit, std::remove_const_t<X>>)
+    void interpolate(const std::span<X> xs, const std::span<YUnit> out) const
+    {
+        if constexpr (kIsUniform)
+        {
+            // The position (x - x0) / step is x.count() * scale - offset, the cast to Abscissa
+            // included.
+            constexpr T kInverseStep{T{1} / lookup_table_helper::step_v<Abscissa, Grid>};
+            using Query = std::remove_const_t<X>;
+            constexpr T kScale{static_cast<T>(Abscissa{Query{1}}.count()) * kInverseStep};
+            lookup_table_helper::interpolateUniform(xs.data(), xs.size(), kScale,
+                                                    xs_.front() * kInverseStep, ys_.data(),
+                                                    slopes_.data(), slopes_.size(), out.data());
+        }
+        else
+        {
+            for (std::size_t i{0}; i < xs.size(); ++i)
+            {
+                out[i] = YUnit{number_helper::narrow<typename YUnit::Rep>(
+                    interpolate(Abscissa{xs[i]}.count()))};
+            }
+        }
+    }
+
+  private:
+    LookupTable() = default;
+
+    void setOrdinates(const std::span<const YUnit> ys)
+    {
+        ys_.reserve(ys.size());
+        for (const YUnit& y : ys)
+        {
+            ys_.push_back(number_helper::widen(y.count()));
+        }
+        slopes_.reserve(ys_.size() - 1);
+        for (std::size_t i{0}; i + 1 < ys_.size(); ++i)
+        {
+            slopes_.push_back(ys_[i + 1] - ys_[i]);
+        }
+    }
+
+    /// Interpolate at an abscissa in counts of XUnit.
+    T interpolate(const T x) const
+    {
+        std::size_t cell{0};
+        T fraction{0};
+        if constexpr (kIsUniform)
+        {
+            constexpr T kInverseStep{T{1} / lookup_table_helper::step_v<Abscissa, Grid>};
+            const T last{static_cast<T>(slopes_.size())};
+            const T position{std::clamp((x - xs_.front()) * kInverseStep, T{0}, last)};
+            cell = std::min(static_cast<std::size_t>(position), slopes_.size() - 1);
+            fraction = position - static_cast<T>(cell);
+        }
+        else
+        {
+            const auto upper = std::upper_bound(xs_.begin() + 1, xs_.end() - 1, x);
+            cell = static_cast<std::size_t>(upper - xs_.begin()) - 1;
+            fraction = std::clamp((x - xs_[cell]) / (xs_[cell + 1] - xs_[cell]), T{0}, T{1});
+        }
+        return ys_[cell] + slopes_[cell] * fraction;
+    }
+
+    /// The abscissas of a non-uniform grid, or only the first one of a uniform grid.
+    std::vector<T> xs_{};
+    std::vector<T> ys_{};
+    std::vector<T> slopes_{};
+};
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_LOOKUP_TABLE_H_
@@ -0,0 +1,185 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_ROLLING_WINDOW_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_ROLLING_WINDOW_H_
+
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <utility>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/number.h"
+
+namespace cpu
+{
+namespace rolling_window_helper
+{
+/// Neumaier compensated sum, which stays accurate when the evicted values are subtracted.
+class CompensatedSum
+{
+  public:
+    constexpr void add(const double value)
+    {
+        const double sum{sum_ + value};
+        const bool sum_larger{(sum_ < 0 ? -sum_ : sum_) >= (value < 0 ? -value : value)};
+        compensation_ += sum_larger ? (sum_ - sum) + value : (value - sum) + sum_;
+        sum_ = sum;
+    }
+
+    constexpr double value() const { return sum_ + compensation_; }
+
+    constexpr void reset()
+    {
+        sum_ = 0.0;
+        compensation_ = 0.0;
+    }
+
+  private:
+    double sum_{0.0};
+    double compensation_{0.0};
+};
+} // namespace rolling_window_helper
+
+/**
+ * Incremental aggregations over the samples of the last window of time.
+ * @details The window of the newest time t holds the samples of (t - window, t]. A push evicts the
+ *          expired samples, so every sample is added and evicted once, i.e. O(1) amortized:
+ *              * min and max with monotonic deques,
+ *              * mean with a compensated running sum,
+ *              * rate, the derivative from the oldest to the newest sample, e.g. the speed in
+ *                Meter per Second of a cumulative distance.
+ * @tparam ValueCU the compound unit of the values.
+ * @tparam TimeCU the compound unit of the timestamps.
+ */
+template <CompoundUnitConcept ValueCU, CompoundUnitConcept TimeCU>
+class RollingWindow
+{
+  public:
+    /// @brief The unit of mean(), ValueCU with a floating point rep.
+    using MeanUnit = decltype(std::declval<ValueCU>() * 1.0);
+    /// @brief The unit of rate().
+    using RateUnit = divide_unit_t<MeanUnit, TimeCU>;
+
+    /// @brief Constructor, the window is converted once to TimeCU. The conversion must not
+    ///        truncate, i.e. a finer window needs a floating point TimeCU, e.g. MilliSecond{500}
+    ///        would be a window of 0 Second.
+    /// @pre window > 0, otherwise every sample expires at once.
+    template <CompoundUnitConcept WindowCU>
+    requires(compound_unit_helper::are_compound_units_castable_v<TimeCU, WindowCU> &&
+             (std::floating_point<number_helper::compute_rep_t<typename TimeCU::Rep>> ||
+              conversion_cost_v<WindowCU, TimeCU> != ConversionCost::LossyDivide))
+    explicit RollingWindow(const WindowCU window) : window_{unit_cast<TimeCU>(window)}
+    {}
+
+    /**
+     * Add a sample and evict the expired ones.
+     * @pre time is not older than the newest sample.
+     */
+    void push(const TimeCU time, const ValueCU value)
+    {
+        samples_.push_back({time, value});
+        sum_.add(static_cast<double>(number_helper::widen(value.count())));
+        while (!min_.empty() && !(min_.back().value < value))
+        {
+            min_.pop_back();
+        }
+        min_.push_back({time, value});
+        while (!max_.empty() && !(value < max_.back().value))
+        {
+            max_.pop_back();
+        }
+        max_.push_back({time, value});
+        evict(time);
+    }
+
+    /// @brief Remove all the samples.
+    void clear()
+    {
+        samples_.clear();
+        min_.clear();
+        max_.clear();
+        sum_.reset();
+    }
+
+    std::size_t size() const { return samples_.size(); }
+
+    bool empty() const { return samples_.empty(); }
+
+    TimeCU window() const { return window_; }
+
+    /// @brief Aggregations of the samples in the window, std::nullopt when it is empty.
+    ///@{
+    std::optional<ValueCU> min() const
+    {
+        return min_.empty() ? std::nullopt : std::optional<ValueCU>{min_.front().value};
+    }
+
+    std::optional<ValueCU> max() const
+    {
+        return max_.empty() ? std::nullopt : std::optional<ValueCU>{max_.front().value};
+    }
+
+    std::optional<MeanUnit> mean() const
+    {
+        if (samples_.empty())
+        {
+            return std::nullopt;
+        }
+        return MeanUnit{sum_.value() / static_cast<double>(samples_.size())};
+    }
+    ///@}
+
+    /// @brief (newest - oldest value) / (newest - oldest time), std::nullopt without a time span.
+    std::optional<RateUnit> rate() const
+    {
+        if (samples_.empty() || !(samples_.front().time < samples_.back().time))
+        {
+            return std::nullopt;
+        }
+        const MeanUnit delta{static_cast<double>(
+            number_helper::widen(samples_.back().value.count()) -
+            number_helper::widen(samples_.front().value.count()))};
+        return delta / (samples_.back().time - samples_.front().time);
+    }
+
+  private:
+    struct Sample
+    {
+        TimeCU time;
+        ValueCU value;
+    };
+
+    void evict(const TimeCU newest)
+    {
+        const TimeCU cutoff{newest - window_};
+        while (!samples_.empty() && !(cutoff < samples_.front().time))
+        {
+            sum_.add(-static_cast<double>(number_helper::widen(samples_.front().value.count())));
+            samples_.pop_front();
+        }
+        while (!min_.empty() && !(cutoff < min_.front().time))
+        {
+            min_.pop_front();
+        }
+        while (!max_.empty() && !(cutoff < max_.front().time))
+        {
+            max_.pop_front();
+        }
+        if (samples_.size() == 1)
+        {
+            // Drop the rounding error accumulated by the evictions.
+            sum_.reset();
+            sum_.add(static_cast<double>(number_helper::widen(samples_.front().value.count())));
+        }
+    }
+
+    TimeCU window_;
+    std::deque<Sample> samples_{};
+    std::deque<Sample> min_{};
+    std::deque<Sample> max_{};
+    rolling_window_helper::CompensatedSum sum_{};
+};
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_ROLLING_WINDOW_H_
@@ -0,0 +1,126 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_SHARDED_COUNTER_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_SHARDED_COUNTER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+#include "ypz/strong_type/atomic_unit.h"
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/number.h"
+#include "ypz/strong_type/helpers/type.h"
+
+namespace cpu
+{
+namespace sharded_counter_helper
+{
+/// The size of a cache line, the slots of a sharded counter are aligned to it.
+#if defined(__APPLE__) && defined(__aarch64__)
+inline constexpr std::size_t kCacheLineSize{128};
+#else
+inline constexpr std::size_t kCacheLineSize{64};
+#endif
+
+/// Index of the calling thread, assigned round robin on its first use of any sharded counter.
+inline std::size_t threadIndex()
+{
+    static std::atomic<std::size_t> next_index{0};
+    thread_local const std::size_t index{next_index.fetch_add(1, std::memory_order_relaxed)};
+    return index;
+}
+
+/**
+ * The Rep of the total of a sharded counter.
+ * @details Integer counts are summed in a 128-bit integer where available, floating counts in
+ *          at least double.
+ */
+template <class Rep>
+using total_rep_t = std::conditional_t<
+    std::floating_point<Rep>, std::common_type_t<Rep, double>,
+#if defined(__SIZEOF_INT128__)
+    number_helper::int128_t
+#else
+    std::int64_t
+#endif
+    >;
+} // namespace sharded_counter_helper
+
+/**
+ * Counter sharded over cache-line padded slots, e.g. for a counter incremented from many cores.
+ * @details Each thread increments its own slot with a relaxed atomic add, so that the
+ *          increments of different threads do not contend on one cache line. snapshot() folds
+ *          the slots into a typed total.
+ * @tparam CU the compound unit of the increments.
+ */
+template <AtomicCompatibleUnitConcept CU>
+class ShardedCounter
+{
+  public:
+    using Unit = CU;
+    using Rep = typename CU::Rep;
+
+    /// @brief The compound unit of the total, i.e. CU with a wider Rep.
+    using TotalUnit = type_helper::make_specialization_t<
+        CompoundUnit, typename CU::Signatures::template push_front_t<
+                          sharded_counter_helper::total_rep_t<Rep>>>;
+
+    /// @brief Construct with `shards` slots, by default one per hardware thread.
+    explicit ShardedCounter(const std::size_t shards = std::thread::hardware_concurrency())
+        : shards_{std::max<std::size_t>(shards, 1U)}, slots_{std::make_unique<Slot[]>(shards_)}
+    {}
+
+    /// @brief The number of slots.
+    std::size_t shards() const { return shards_; }
+
+    /// @brief Add a castable compound unit to the slot of the calling thread.
+    template <CompoundUnitConcept X>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, X>)
+    void add(const X& delta)
+    {
+        slots_[sharded_counter_helper::threadIndex() % shards_].count.fetch_add(
+            CU{delta}.count(), std::memory_order_relaxed);
+    }
+
+    /**
+     * Fold the slots into the total.
+     * @details The total is consistent with all the increments that happen before the call, and
+     *          may or may not include the concurrent ones.
+     */
+    TotalUnit snapshot() const
+    {
+        using TotalRep = typename TotalUnit::Rep;
+        TotalRep total{0};
+        for (std::size_t i{0}; i < shards_; ++i)
+        {
+            total += static_cast<TotalRep>(slots_[i].count.load(std::memory_order_relaxed));
+        }
+        return TotalUnit{total};
+    }
+
+    /// @brief Reset all the slots to zero. Concurrent increments may or may not be kept.
+    void reset()
+    {
+        for (std::size_t i{0}; i < shards_; ++i)
+        {
+            slots_[i].count.store(Rep{0}, std::memory_order_relaxed);
+        }
+    }
+
+  private:
+    struct alignas(sharded_counter_helper::kCacheLineSize) Slot
+    {
+        std::atomic<Rep> count{0};
+    };
+
+    std::size_t shards_;
+    std::unique_ptr<Slot[]> slots_;
+};
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_SHARDED_COUNTER_H_
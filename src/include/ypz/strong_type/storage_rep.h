@@ -0,0 +1,260 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_STORAGE_REP_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_STORAGE_REP_H_
+
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <optional>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/number.h"
+#include "ypz/strong_type/helpers/type.h"
+#include "ypz/strong_type/signature.h"
+
+namespace cpu
+{
+/**
+ * IEEE 754 binary16 storage rep.
+ * @details Only the storage is half precision, the arithmetic of compound units is carried out
+ *          in float. Conversion from float rounds to nearest even.
+ */
+class float16
+{
+  public:
+    constexpr float16() = default;
+
+    explicit constexpr float16(const float value) : bits_{fromFloat(value)} {}
+
+    /// @brief Construct from the raw binary16 bits.
+    static constexpr float16 fromBits(const std::uint16_t bits)
+    {
+        float16 ret{};
+        ret.bits_ = bits;
+        return ret;
+    }
+
+    /// @brief Get the raw binary16 bits.
+    constexpr std::uint16_t bits() const { return bits_; }
+
+    explicit constexpr operator float() const { return toFloat(bits_); }
+
+    friend constexpr bool operator==(const float16 lhs, const float16 rhs)
+    {
+        return static_cast<float>(lhs) == static_cast<float>(rhs);
+    }
+
+    friend constexpr std::partial_ordering operator<=>(const float16 lhs, const float16 rhs)
+    {
+        return static_cast<float>(lhs) <=> static_cast<float>(rhs);
+    }
+
+  private:
+    static constexpr std::uint16_t fromFloat(const float value)
+    {
+        const std::uint32_t x{std::bit_cast<std::uint32_t>(value)};
+        const std::uint32_t sign{(x >> 16) & 0x8000U};
+        const std::uint32_t abs{x & 0x7FFF'FFFFU};
+
+        if (abs > 0x7F80'0000U) // NaN, keep it quiet.
+        {
+            return static_cast<std::uint16_t>(sign | 0x7E00U | ((abs >> 13) & 0x3FFU));
+        }
+        if (abs >= 0x4780'0000U) // Infinity, or overflow (>= 65536).
+        {
+            return static_cast<std::uint16_t>(sign | 0x7C00U);
+        }
+        if (abs < 0x3880'0000U) // Subnormal or zero in binary16 (< 2^-14).
+        {
+            if (abs < 0x3300'0000U) // Rounds to zero (<= 2^-25).
+            {
+                return static_cast<std::uint16_t>(sign);
+            }
+            const std::uint32_t mantissa{(abs & 0x7F'FFFFU) | 0x80'0000U};
+            const std::uint32_t shift{126U - (abs >> 23)};
+            return static_cast<std::uint16_t>(sign | roundShift(mantissa, shift));
+        }
+        // Normal number, rebias the exponent from 127 to 15.
+        return static_cast<std::uint16_t>(sign | roundShift(abs - 0x3800'0000U, 13U));
+    }
+
+    static constexpr float toFloat(const std::uint16_t bits)
+    {
+        const std::uint32_t sign{static_cast<std::uint32_t>(bits & 0x8000U) << 16};
+        const std::uint32_t exp{(bits >> 10) & 0x1FU};
+        const std::uint32_t mantissa{bits & 0x3FFU};
+
+        if (exp == 0x1FU) // Infinity or NaN.
+        {
+            return std::bit_cast<float>(sign | 0x7F80'0000U | (mantissa << 13));
+        }
+        if (exp == 0U) // Subnormal or zero, mantissa * 2^-24.
+        {
+            const float magnitude{static_cast<float>(mantissa) * 5.9604644775390625e-8F};
+            return sign != 0U ? -magnitude : magnitude;
+        }
+        return std::bit_cast<float>(sign | ((exp + 112U) << 23) | (mantissa << 13));
+    }
+
+    /// Shift right by `shift` bits, rounding to nearest even.
+    static constexpr std::uint32_t roundShift(const std::uint32_t value, const std::uint32_t shift)
+    {
+        const std::uint32_t truncated{value >> shift};
+        const std::uint32_t remainder{value & ((1U << shift) - 1U)};
+        const std::uint32_t halfway{1U << (shift - 1U)};
+        const bool round_up{remainder > halfway || (remainder == halfway && (truncated & 1U))};
+        return truncated + (round_up ? 1U : 0U);
+    }
+
+    std::uint16_t bits_;
+};
+
+/**
+ * bfloat16 storage rep, i.e. the upper half of an IEEE 754 binary32.
+ * @details Only the storage is half width, the arithmetic of compound units is carried out in
+ *          float. Conversion from float rounds to nearest even.
+ */
+class bfloat16
+{
+  public:
+    constexpr bfloat16() = default;
+
+    explicit constexpr bfloat16(const float value) : bits_{fromFloat(value)} {}
+
+    /// @brief Construct from the raw bfloat16 bits.
+    static constexpr bfloat16 fromBits(const std::uint16_t bits)
+    {
+        bfloat16 ret{};
+        ret.bits_ = bits;
+        return ret;
+    }
+
+    /// @brief Get the raw bfloat16 bits.
+    constexpr std::uint16_t bits() const { return bits_; }
+
+    explicit constexpr operator float() const
+    {
+        return std::bit_cast<float>(static_cast<std::uint32_t>(bits_) << 16);
+    }
+
+    friend constexpr bool operator==(const bfloat16 lhs, const bfloat16 rhs)
+    {
+        return static_cast<float>(lhs) == static_cast<float>(rhs);
+    }
+
+    friend constexpr std::partial_ordering operator<=>(const bfloat16 lhs, const bfloat16 rhs)
+    {
+        return static_cast<float>(lhs) <=> static_cast<float>(rhs);
+    }
+
+  private:
+    static constexpr std::uint16_t fromFloat(const float value)
+    {
+        const std::uint32_t x{std::bit_cast<std::uint32_t>(value)};
+        if ((x & 0x7FFF'FFFFU) > 0x7F80'0000U) // NaN, keep it quiet.
+        {
+            return static_cast<std::uint16_t>((x >> 16) | 0x40U);
+        }
+        const std::uint32_t rounding_bias{0x7FFFU + ((x >> 16) & 1U)};
+        return static_cast<std::uint16_t>((x + rounding_bias) >> 16);
+    }
+
+    std::uint16_t bits_;
+};
+
+namespace number_helper
+{
+template <>
+struct rep_traits<float16>
+{
+    using compute_type = float;
+
+    static constexpr compute_type widen(const float16 value) { return static_cast<float>(value); }
+
+    template <NumberConcept U>
+    static constexpr float16 narrow(const U value)
+    {
+        return float16{static_cast<float>(value)};
+    }
+};
+
+template <>
+struct rep_traits<bfloat16>
+{
+    using compute_type = float;
+
+    static constexpr compute_type widen(const bfloat16 value) { return static_cast<float>(value); }
+
+    template <NumberConcept U>
+    static constexpr bfloat16 narrow(const U value)
+    {
+        return bfloat16{static_cast<float>(value)};
+    }
+};
+} // namespace number_helper
+
+namespace storage_rep_helper
+{
+template <UnitSignatureConcept Signature, number_helper::RatioConcept Scale, bool apply>
+using scaled_signature_t = std::conditional_t<
+    apply,
+    UnitSignature<std::conditional_t<Signature::Exp == 1,
+                                     std::ratio_multiply<typename Signature::Period, Scale>,
+                                     std::ratio_divide<typename Signature::Period, Scale>>,
+                  Signature::Exp, typename Signature::Tag>,
+    Signature>;
+
+/**
+ * Fold a scale into the period of a list of signatures.
+ * @details The scale is folded into the first signature whose exponent is 1 or -1, so that the
+ *          period of the compound unit is multiplied by exactly the scale.
+ */
+template <number_helper::RatioConcept Scale, UnitSignatureConcept... Signatures>
+consteval type_helper::TypeListConcept auto foldScaleIntoSignatures(
+    type_helper::TypeList<Signatures...>)
+{
+    using IsUnitExpList =
+        type_helper::TypeList<std::bool_constant<Signatures::Exp == 1 || Signatures::Exp == -1>...>;
+    constexpr std::optional<std::size_t> pos{
+        type_helper::pos_of_type_v<IsUnitExpList, std::true_type>};
+    static_assert(pos.has_value(), "The scale can only be folded into a signature with an "
+                                   "exponent of 1 or -1.");
+    constexpr std::size_t folded_idx{pos.value_or(0U)};
+
+    return []<std::size_t... Is>(std::index_sequence<Is...>) {
+        return type_helper::TypeList<scaled_signature_t<Signatures, Scale, Is == folded_idx>...>{};
+    }(std::index_sequence_for<Signatures...>());
+}
+} // namespace storage_rep_helper
+
+/**
+ * The compound unit with the same signatures as CU, but stored in another rep.
+ * @details E.g. StorageUnit<Meter_double, float16> stores meters in 2 bytes.
+ */
+template <CompoundUnitConcept CU, number_helper::RepConcept StorageRep>
+using StorageUnit = type_helper::make_specialization_t<
+    CompoundUnit, typename CU::Signatures::template push_front_t<StorageRep>>;
+
+/**
+ * Fixed-point compound unit, whose scale is folded into the period of the signatures.
+ * @details E.g. QuantizedUnit<Meter_double, std::int16_t, std::milli> stores millimeters in an
+ *          std::int16_t, and casts from/to Meter_double like any other compound unit.
+ *          Arithmetic is carried out in the promoted integer type, but the results keep
+ *          StorageRep like the ones of any built-in rep, so a product which may overflow it is
+ *          taken after a cast to a wider rep, e.g. StorageUnit<MilliMeter_i16, int>.
+ * @tparam CU the compound unit to quantize.
+ * @tparam StorageRep the signed integer rep for storage.
+ * @tparam Scale the value of one count, relative to the period of CU.
+ */
+template <CompoundUnitConcept CU, std::signed_integral StorageRep,
+          number_helper::RatioConcept Scale>
+using QuantizedUnit = type_helper::make_specialization_t<
+    CompoundUnit,
+    typename decltype(storage_rep_helper::foldScaleIntoSignatures<Scale>(
+        typename CU::Signatures{}))::template push_front_t<StorageRep>>;
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_STORAGE_REP_H_
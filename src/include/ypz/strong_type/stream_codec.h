@@ -0,0 +1,696 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_STREAM_CODEC_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_STREAM_CODEC_H_
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/type.h"
+
+namespace cpu
+{
+/**
+ * Concept for a compound unit that can be streamed by StreamEncoder/StreamDecoder.
+ * @details Integer reps are delta + zigzag + varint coded, float and double reps are XOR coded
+ *          (Gorilla style).
+ */
+template <class CU>
+concept StreamableUnitConcept =
+    CompoundUnitConcept<CU> &&
+    (std::signed_integral<typename CU::Rep> ||
+     (std::floating_point<typename CU::Rep> &&
+      (sizeof(typename CU::Rep) == 4 || sizeof(typename CU::Rep) == 8)));
+
+namespace codec_helper
+{
+enum class StreamKind : std::uint8_t
+{
+    DeltaVarint = 1,
+    XorFloat = 2,
+};
+
+inline constexpr std::uint8_t kMagic[4]{'Y', 'P', 'Z', 'U'};
+inline constexpr std::uint8_t kVersion{1};
+inline constexpr std::size_t kHeaderSize{sizeof(kMagic) + 2 + sizeof(std::uint64_t)};
+
+template <StreamableUnitConcept CU>
+constexpr StreamKind stream_kind_v{
+    std::floating_point<typename CU::Rep> ? StreamKind::XorFloat : StreamKind::DeltaVarint};
+
+/// The unsigned integer type that holds the bits of a rep.
+template <StreamableUnitConcept CU>
+using rep_bits_t = std::conditional_t<sizeof(typename CU::Rep) == 8, std::uint64_t,
+                                      std::make_unsigned_t<std::conditional_t<
+                                          std::floating_point<typename CU::Rep>, std::int32_t,
+                                          typename CU::Rep>>>;
+
+constexpr std::uint64_t lowBitsMask(const unsigned n)
+{
+    return n >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << n) - 1U;
+}
+
+inline void putVarint(std::vector<std::uint8_t>& out, std::uint64_t value)
+{
+    while (value >= 0x80U)
+    {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80U));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+/// Read a LEB128 varint, return std::nullopt if the input is truncated or malformed.
+inline std::optional<std::uint64_t> getVarint(std::span<const std::uint8_t> input,
+                                              std::size_t& pos)
+{
+    std::uint64_t value{0};
+    for (unsigned shift{0}; shift < 64 && pos < input.size(); shift += 7)
+    {
+        const std::uint8_t byte{input[pos++]};
+        value |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+        if (byte < 0x80U)
+        {
+            return value;
+        }
+    }
+    return std::nullopt;
+}
+
+/// Reverse the order of the bytes of a word, which the compilers reduce to one instruction.
+constexpr std::uint64_t byteSwap64(std::uint64_t word)
+{
+    word = ((word & 0x00FF'00FF'00FF'00FFULL) << 8) | ((word >> 8) & 0x00FF'00FF'00FF'00FFULL);
+    word = ((word & 0x0000'FFFF'0000'FFFFULL) << 16) | ((word >> 16) & 0x0000'FFFF'0000'FFFFULL);
+    return (word << 32) | (word >> 32);
+}
+
+/// Load 8 unaligned bytes in little or big endian order.
+///@{
+inline std::uint64_t loadLittleEndian64(const std::uint8_t* const bytes)
+{
+    std::uint64_t word{0};
+    std::memcpy(&word, bytes, sizeof(word));
+    return std::endian::native == std::endian::little ? word : byteSwap64(word);
+}
+
+inline std::uint64_t loadBigEndian64(const std::uint8_t* const bytes)
+{
+    std::uint64_t word{0};
+    std::memcpy(&word, bytes, sizeof(word));
+    return std::endian::native == std::endian::big ? word : byteSwap64(word);
+}
+///@}
+
+/**
+ * Decode a varint of at most 8 bytes from the little endian load of its first bytes, without a
+ * loop over the bytes.
+ * @return the length of the varint, or 0 if it is longer than 8 bytes.
+ */
+constexpr unsigned decodeVarintWord(const std::uint64_t word, std::uint64_t& value)
+{
+    const std::uint64_t stops{~word & 0x8080'8080'8080'8080ULL};
+    if (stops == 0)
+    {
+        return 0;
+    }
+    const unsigned length{static_cast<unsigned>(std::countr_zero(stops)) / 8U + 1U};
+    // Drop the continuation bits, then pack the 7 bit groups pairwise.
+    std::uint64_t x{word & lowBitsMask(8U * length) & 0x7F7F'7F7F'7F7F'7F7FULL};
+    x = (x & 0x007F'007F'007F'007FULL) | ((x & 0x7F00'7F00'7F00'7F00ULL) >> 1);
+    x = (x & 0x0000'3FFF'0000'3FFFULL) | ((x & 0x3FFF'0000'3FFF'0000ULL) >> 2);
+    x = (x & 0x0000'0000'0FFF'FFFFULL) | ((x & 0x0FFF'FFFF'0000'0000ULL) >> 4);
+    value = x;
+    return length;
+}
+
+constexpr std::uint64_t zigzagEncode(const std::uint64_t delta)
+{
+    return (delta << 1) ^ (0U - (delta >> 63));
+}
+
+constexpr std::uint64_t zigzagDecode(const std::uint64_t value)
+{
+    return (value >> 1) ^ (0U - (value & 1U));
+}
+
+/// MSB-first bit writer, used by the XOR coding.
+class BitWriter
+{
+  public:
+    /// Append the low `n` bits of `value`, 1 <= n <= 64.
+    void write(std::vector<std::uint8_t>& out, std::uint64_t value, const unsigned n)
+    {
+        value &= lowBitsMask(n);
+        const unsigned free{64U - acc_bits_};
+        if (n <= free)
+        {
+            acc_ = n == 64 ? value : (acc_ << n) | value;
+            acc_bits_ += n;
+        }
+        else
+        {
+            const unsigned rest{n - free};
+            acc_ = (acc_ << free) | (value >> rest);
+            acc_bits_ = 64;
+            drain(out);
+            acc_ = value & lowBitsMask(rest);
+            acc_bits_ = rest;
+        }
+        if (acc_bits_ == 64)
+        {
+            drain(out);
+        }
+    }
+
+    /// Write the pending bits, padded with zeros to a byte boundary.
+    void flush(std::vector<std::uint8_t>& out)
+    {
+        if (acc_bits_ > 0)
+        {
+            const std::uint64_t aligned{acc_ << (64U - acc_bits_)};
+            for (unsigned i{0}; i < (acc_bits_ + 7U) / 8U; ++i)
+            {
+                out.push_back(static_cast<std::uint8_t>(aligned >> (56U - 8U * i)));
+            }
+        }
+        acc_ = 0;
+        acc_bits_ = 0;
+    }
+
+  private:
+    void drain(std::vector<std::uint8_t>& out)
+    {
+        for (unsigned i{0}; i < 8U; ++i)
+        {
+            out.push_back(static_cast<std::uint8_t>(acc_ >> (56U - 8U * i)));
+        }
+        acc_ = 0;
+        acc_bits_ = 0;
+    }
+
+    std::uint64_t acc_{0};
+    unsigned acc_bits_{0};
+};
+
+/// MSB-first bit reader over a byte span, used by the XOR coding.
+class BitReader
+{
+  public:
+    /// Buffer more bytes, up to 56 bits or more, with one load unless near the end of the input.
+    void refill(std::span<const std::uint8_t> input, std::size_t& pos)
+    {
+        if (window_bits_ >= 56U)
+        {
+            return;
+        }
+        if (input.size() - pos >= 8U)
+        {
+            const unsigned bytes{(63U - window_bits_) / 8U};
+            window_ = (window_ << (8U * bytes)) |
+                      (loadBigEndian64(input.data() + pos) >> (64U - 8U * bytes));
+            window_bits_ += 8U * bytes;
+            pos += bytes;
+        }
+        else
+        {
+            while (window_bits_ < 56U && pos < input.size())
+            {
+                window_ = (window_ << 8) | input[pos++];
+                window_bits_ += 8U;
+            }
+        }
+    }
+
+    /// The number of buffered bits.
+    unsigned available() const { return window_bits_; }
+
+    /// The next `n` buffered bits, 1 <= n <= available(), without consuming them.
+    std::uint64_t peek(const unsigned n) const
+    {
+        return (window_ >> (window_bits_ - n)) & lowBitsMask(n);
+    }
+
+    /// Consume `n` buffered bits, n <= available().
+    void skip(const unsigned n) { window_bits_ -= n; }
+
+    /// Read `n` bits, 1 <= n <= 64. Return false if the input is exhausted.
+    bool read(std::span<const std::uint8_t> input, std::size_t& pos, const unsigned n,
+              std::uint64_t& value)
+    {
+        if (n > window_bits_)
+        {
+            if (n > 56U)
+            {
+                std::uint64_t high{0};
+                std::uint64_t low{0};
+                if (!read(input, pos, n - 32U, high) || !read(input, pos, 32U, low))
+                {
+                    return false;
+                }
+                value = (high << 32) | low;
+                return true;
+            }
+            refill(input, pos);
+            if (n > window_bits_)
+            {
+                return false;
+            }
+        }
+        value = peek(n);
+        skip(n);
+        return true;
+    }
+
+    /// Drop the padding bits up to the next byte boundary, and give back the bytes read ahead.
+    void align(std::size_t& pos)
+    {
+        pos -= window_bits_ / 8U;
+        window_bits_ = 0;
+    }
+
+  private:
+    std::uint64_t window_{0};
+    unsigned window_bits_{0};
+};
+
+/// Continue the FNV-1a hash over the 8 bytes of an integer, least significant first.
+consteval std::uint64_t fnv1aInteger(const std::uint64_t hash, const std::intmax_t value)
+{
+    char bytes[8]{};
+    for (unsigned i{0}; i < 8U; ++i)
+    {
+        bytes[i] = static_cast<char>(static_cast<std::uintmax_t>(value) >> (8U * i));
+    }
+    return type_helper::fnv1a(std::string_view{bytes, sizeof(bytes)}, hash);
+}
+
+/// Continue the FNV-1a hash over the tag name, the period and the exponent of a signature.
+template <UnitSignatureConcept Signature>
+consteval std::uint64_t fnv1aSignature(std::uint64_t hash)
+{
+    hash = type_helper::fnv1a(type_helper::typeName<typename Signature::Tag>(), hash);
+    hash = fnv1aInteger(hash, Signature::Period::num);
+    hash = fnv1aInteger(hash, Signature::Period::den);
+    return fnv1aInteger(hash, Signature::Exp);
+}
+
+/// The hash of the canonical description of a compound unit.
+template <CompoundUnitConcept CU>
+consteval std::uint64_t unitFingerprint()
+{
+    using Rep = typename CU::Rep;
+    std::uint64_t hash{
+        fnv1aInteger(type_helper::fnv1a(std::floating_point<Rep> ? "float" : "int"), sizeof(Rep))};
+    [&hash]<UnitSignatureConcept... Signatures>(type_helper::TypeList<Signatures...>) consteval {
+        ((hash = fnv1aSignature<Signatures>(hash)), ...);
+    }(typename CU::Signatures{});
+    return hash;
+}
+} // namespace codec_helper
+
+/**
+ * Fingerprint of a compound unit, written into the header of an encoded stream.
+ * @details The fingerprint is a hash of a canonical description of the unit, i.e. whether its
+ *          Rep is an integer or a floating point and its size, then the period, the exponent
+ *          and the tag name of each signature in order. It does not depend on how the compiler
+ *          spells the Rep or the ratios, e.g. long and long long of the same size, but the tags
+ *          are identified by their type_helper::typeName(), which GCC and Clang spell alike and
+ *          MSVC does not, e.g. with a "struct " prefix. Tags in an anonymous namespace are
+ *          spelled alike in every translation unit.
+ */
+template <CompoundUnitConcept CU>
+constexpr std::uint64_t unit_fingerprint_v{codec_helper::unitFingerprint<CU>()};
+
+/**
+ * Streaming encoder for a sequence of compound units.
+ * @details The stream consists of a header (magic, version, coding kind and unit fingerprint)
+ *          and a sequence of frames. Each call of flush() appends one frame holding the values
+ *          pushed since the last flush, the coding state carries over between frames.
+ *          Integer reps are coded as zigzag varints of the deltas, float reps as the XOR of
+ *          consecutive values with a reused leading/trailing zero window.
+ * @tparam CU the compound unit to encode.
+ */
+template <StreamableUnitConcept CU>
+class StreamEncoder
+{
+  public:
+    using Rep = typename CU::Rep;
+
+    /// @brief Construct an encoder which appends to `sink`, the header is written immediately.
+    explicit StreamEncoder(std::vector<std::uint8_t>& sink) : sink_{sink}
+    {
+        sink_.insert(sink_.end(), std::begin(codec_helper::kMagic),
+                     std::end(codec_helper::kMagic));
+        sink_.push_back(codec_helper::kVersion);
+        sink_.push_back(static_cast<std::uint8_t>(codec_helper::stream_kind_v<CU>));
+        for (unsigned i{0}; i < 8U; ++i)
+        {
+            sink_.push_back(static_cast<std::uint8_t>(unit_fingerprint_v<CU> >> (8U * i)));
+        }
+    }
+
+    StreamEncoder(const StreamEncoder&) = delete;
+    StreamEncoder& operator=(const StreamEncoder&) = delete;
+
+    /// @brief Flush the pending values on destruction.
+    ~StreamEncoder() { flush(); }
+
+    /// @brief Push one value, castable compound units are converted to CU.
+    void push(const CU value) { pushCount(value.count()); }
+
+    /// @brief Push a contiguous sequence of values.
+    void push(std::span<const CU> values)
+    {
+        for (const CU& value : values)
+        {
+            pushCount(value.count());
+        }
+    }
+
+    /// @brief Append a frame with the values pushed since the last flush.
+    void flush()
+    {
+        if (pending_count_ == 0)
+        {
+            return;
+        }
+        if constexpr (codec_helper::stream_kind_v<CU> == codec_helper::StreamKind::XorFloat)
+        {
+            bit_writer_.flush(pending_);
+        }
+        codec_helper::putVarint(sink_, pending_count_);
+        sink_.insert(sink_.end(), pending_.begin(), pending_.end());
+        pending_.clear();
+        pending_count_ = 0;
+    }
+
+  private:
+    using Bits = codec_helper::rep_bits_t<CU>;
+    static constexpr unsigned kWidth{sizeof(Rep) * 8U};
+
+    void pushCount(const Rep count)
+    {
+        if constexpr (codec_helper::stream_kind_v<CU> == codec_helper::StreamKind::DeltaVarint)
+        {
+            // Wrapping delta in unsigned arithmetic, sign extended to 64 bits.
+            const auto current = static_cast<std::uint64_t>(static_cast<std::int64_t>(count));
+            codec_helper::putVarint(pending_, codec_helper::zigzagEncode(current - previous_));
+            previous_ = current;
+        }
+        else
+        {
+            const auto current = std::bit_cast<Bits>(count);
+            const auto x = static_cast<std::uint64_t>(current ^ static_cast<Bits>(previous_));
+            previous_ = current;
+            if (x == 0)
+            {
+                bit_writer_.write(pending_, 0b0U, 1U);
+            }
+            else
+            {
+                const unsigned leading{std::min(
+                    31U, static_cast<unsigned>(std::countl_zero(static_cast<Bits>(x))))};
+                const auto trailing = static_cast<unsigned>(std::countr_zero(x));
+
+                if (window_length_ > 0 && leading >= window_leading_ &&
+                    trailing >= kWidth - window_leading_ - window_length_)
+                { // Reuse the previous window.
+                    bit_writer_.write(pending_, 0b10U, 2U);
+                    bit_writer_.write(pending_,
+                                      x >> (kWidth - window_leading_ - window_length_),
+                                      window_length_);
+                }
+                else
+                {
+                    window_leading_ = leading;
+                    window_length_ = kWidth - leading - trailing;
+                    bit_writer_.write(pending_, 0b11U, 2U);
+                    bit_writer_.write(pending_, window_leading_, 5U);
+                    bit_writer_.write(pending_, window_length_ - 1U, 6U);
+                    bit_writer_.write(pending_, x >> trailing, window_length_);
+                }
+            }
+        }
+        ++pending_count_;
+    }
+
+    std::vector<std::uint8_t>& sink_;
+    std::vector<std::uint8_t> pending_{};
+    std::uint64_t pending_count_{0};
+    std::uint64_t previous_{0};
+
+    codec_helper::BitWriter bit_writer_{};
+    unsigned window_leading_{0};
+    unsigned window_length_{0};
+};
+
+/**
+ * Streaming decoder for a sequence of compound units encoded by StreamEncoder.
+ * @details The header is checked on construction, a stream of another unit or coding is
+ *          rejected. Values are decoded straight into a Rep buffer, and decoding may stop and
+ *          resume at any value.
+ * @tparam CU the compound unit to decode.
+ */
+template <StreamableUnitConcept CU>
+class StreamDecoder
+{
+  public:
+    using Rep = typename CU::Rep;
+
+    /// @brief Construct a decoder over an encoded stream, and check its header.
+    explicit StreamDecoder(std::span<const std::uint8_t> input) : input_{input}
+    {
+        valid_ = input_.size() >= codec_helper::kHeaderSize &&
+                 std::equal(std::begin(codec_helper::kMagic), std::end(codec_helper::kMagic),
+                            input_.begin()) &&
+                 input_[4] == codec_helper::kVersion &&
+                 input_[5] == static_cast<std::uint8_t>(codec_helper::stream_kind_v<CU>);
+        if (valid_)
+        {
+            std::uint64_t fingerprint{0};
+            for (unsigned i{0}; i < 8U; ++i)
+            {
+                fingerprint |= static_cast<std::uint64_t>(input_[6 + i]) << (8U * i);
+            }
+            valid_ = fingerprint == unit_fingerprint_v<CU>;
+        }
+        pos_ = codec_helper::kHeaderSize;
+    }
+
+    /// @brief Whether the header matches CU and no malformed data has been met.
+    bool valid() const { return valid_; }
+
+    /// @brief Whether the whole input has been decoded.
+    bool done() const { return !valid_ || (frame_remaining_ == 0 && pos_ >= input_.size()); }
+
+    /**
+     * Decode values into `out`.
+     * @return the number of decoded values, which is less than out.size() only if the end of
+     *         the input is reached or the input is malformed.
+     */
+    std::size_t decode(std::span<Rep> out)
+    {
+        std::size_t decoded{0};
+        while (valid_ && decoded < out.size())
+        {
+            if (frame_remaining_ == 0)
+            {
+                if (pos_ >= input_.size())
+                {
+                    break;
+                }
+                const auto frame_size = codec_helper::getVarint(input_, pos_);
+                if (!frame_size || *frame_size == 0)
+                {
+                    valid_ = false;
+                    break;
+                }
+                frame_remaining_ = *frame_size;
+            }
+
+            const std::size_t n{static_cast<std::size_t>(
+                std::min<std::uint64_t>(frame_remaining_, out.size() - decoded))};
+            const std::size_t done_in_frame{decodeInFrame(out.subspan(decoded, n))};
+            decoded += done_in_frame;
+            frame_remaining_ -= done_in_frame;
+            if (done_in_frame != n)
+            {
+                valid_ = false;
+                break;
+            }
+            if constexpr (codec_helper::stream_kind_v<CU> == codec_helper::StreamKind::XorFloat)
+            {
+                if (frame_remaining_ == 0)
+                {
+                    bit_reader_.align(pos_);
+                }
+            }
+        }
+        return decoded;
+    }
+
+  private:
+    using Bits = codec_helper::rep_bits_t<CU>;
+    static constexpr unsigned kWidth{sizeof(Rep) * 8U};
+
+    /// Decode out.size() values of the current frame, with the state in locals for the loop.
+    std::size_t decodeInFrame(std::span<Rep> out)
+    {
+        std::size_t pos{pos_};
+        std::uint64_t previous{previous_};
+        std::size_t i{0};
+        if constexpr (codec_helper::stream_kind_v<CU> == codec_helper::StreamKind::DeltaVarint)
+        {
+            const std::uint8_t* const data{input_.data()};
+            const std::size_t size{input_.size()};
+            for (; i < out.size(); ++i)
+            {
+                std::uint64_t zigzag{0};
+                unsigned length{0};
+                if (pos < size && data[pos] < 0x80U)
+                { // Fast path for small deltas.
+                    zigzag = data[pos++];
+                    length = 1;
+                }
+                else if (size - pos >= 8U)
+                { // One load for a varint of up to 8 bytes.
+                    length = codec_helper::decodeVarintWord(
+                        codec_helper::loadLittleEndian64(data + pos), zigzag);
+                    pos += length;
+                }
+                if (length == 0)
+                {
+                    const auto value = codec_helper::getVarint(input_, pos);
+                    if (!value)
+                    {
+                        break;
+                    }
+                    zigzag = *value;
+                }
+                previous += codec_helper::zigzagDecode(zigzag);
+                out[i] = static_cast<Rep>(static_cast<std::int64_t>(previous));
+            }
+        }
+        else
+        {
+            codec_helper::BitReader reader{bit_reader_};
+            unsigned window_leading{window_leading_};
+            unsigned window_length{window_length_};
+            for (; i < out.size(); ++i)
+            {
+                // The control bits and the window header are at most 13 bits.
+                if (reader.available() < 13U)
+                {
+                    reader.refill(input_, pos);
+                }
+                const unsigned available{reader.available()};
+                if (available == 0)
+                {
+                    break;
+                }
+                // 0: the same value, 10: the previous window, 11: a new window.
+                const std::uint64_t control{available >= 2U ? reader.peek(2U)
+                                                            : reader.peek(1U) << 1};
+                if (control < 0b10U)
+                {
+                    reader.skip(1U);
+                }
+                else
+                {
+                    if (control == 0b11U)
+                    {
+                        if (available < 13U)
+                        {
+                            break;
+                        }
+                        const std::uint64_t header{reader.peek(13U)};
+                        const auto leading = static_cast<unsigned>(header >> 6) & 0x1FU;
+                        const auto length = static_cast<unsigned>(header & 0x3FU) + 1U;
+                        if (leading + length > kWidth)
+                        {
+                            break;
+                        }
+                        reader.skip(13U);
+                        window_leading = leading;
+                        window_length = length;
+                    }
+                    else
+                    {
+                        if (available < 2U || window_length == 0)
+                        {
+                            break;
+                        }
+                        reader.skip(2U);
+                    }
+                    std::uint64_t meaningful{0};
+                    if (!reader.read(input_, pos, window_length, meaningful))
+                    {
+                        break;
+                    }
+                    previous ^= meaningful << (kWidth - window_leading - window_length);
+                }
+                out[i] = std::bit_cast<Rep>(static_cast<Bits>(previous));
+            }
+            bit_reader_ = reader;
+            window_leading_ = window_leading;
+            window_length_ = window_length;
+        }
+        pos_ = pos;
+        previous_ = previous;
+        return i;
+    }
+
+    std::span<const std::uint8_t> input_;
+    std::size_t pos_{0};
+    bool valid_{false};
+    std::uint64_t frame_remaining_{0};
+    std::uint64_t previous_{0};
+
+    codec_helper::BitReader bit_reader_{};
+    unsigned window_leading_{0};
+    unsigned window_length_{0};
+};
+
+/// Encode a sequence of compound units into a stream with a single frame.
+template <StreamableUnitConcept CU>
+std::vector<std::uint8_t> encodeStream(std::span<const CU> values)
+{
+    std::vector<std::uint8_t> bytes{};
+    {
+        StreamEncoder<CU> encoder{bytes};
+        encoder.push(values);
+    }
+    return bytes;
+}
+
+/// Decode a whole stream, return std::nullopt if it is not a valid stream of CU.
+template <StreamableUnitConcept CU>
+std::optional<std::vector<typename CU::Rep>> decodeStream(std::span<const std::uint8_t> bytes)
+{
+    StreamDecoder<CU> decoder{bytes};
+    std::vector<typename CU::Rep> counts{};
+    while (decoder.valid() && !decoder.done())
+    {
+        const std::size_t offset{counts.size()};
+        counts.resize(offset + 4096U);
+        counts.resize(offset + decoder.decode(std::span{counts}.subspan(offset)));
+    }
+    if (!decoder.valid())
+    {
+        return std::nullopt;
+    }
+    return counts;
+}
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_STREAM_CODEC_H_
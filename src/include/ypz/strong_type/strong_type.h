@@ -0,0 +1,35 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_STRONG_TYPE_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_STRONG_TYPE_H_
+
+/**
+ * Umbrella header of all the public headers.
+ * @details For toolchains without support of named modules, this header can be compiled once as
+ *          a header unit (import <ypz/strong_type/strong_type.h>;) or as a precompiled header.
+ *          With named modules, prefer import ypz.strong_type;
+ */
+
+#include "ypz/strong_type/atomic_unit.h"
+#include "ypz/strong_type/bounded.h"
+#include "ypz/strong_type/calibrated_unit.h"
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/constant.h"
+#include "ypz/strong_type/csv_reader.h"
+#include "ypz/strong_type/dimension_unit.h"
+#include "ypz/strong_type/formula.h"
+#include "ypz/strong_type/histogram.h"
+#include "ypz/strong_type/instrument.h"
+#include "ypz/strong_type/integrate.h"
+#include "ypz/strong_type/lookup_table.h"
+#include "ypz/strong_type/rolling_window.h"
+#include "ypz/strong_type/sharded_counter.h"
+#include "ypz/strong_type/signature.h"
+#include "ypz/strong_type/storage_rep.h"
+#include "ypz/strong_type/stream_codec.h"
+#include "ypz/strong_type/timer.h"
+#include "ypz/strong_type/unit_accessor.h"
+#include "ypz/strong_type/unit_array.h"
+#include "ypz/strong_type/unit_table.h"
+#include "ypz/strong_type/unit_views.h"
+#include "ypz/strong_type/vec.h"
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_STRONG_TYPE_H_
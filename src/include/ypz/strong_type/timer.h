@@ -0,0 +1,254 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_TIMER_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_TIMER_H_
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <ratio>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+#include "ypz/strong_type/calibrated_unit.h"
+#include "ypz/strong_type/compound_unit.h"
+
+namespace cpu
+{
+/// The duration of a tick of readTsc() in seconds, NaN until calibrateTsc() or the first timer.
+inline RuntimePeriod tsc_period{std::numeric_limits<double>::quiet_NaN()};
+
+/// The second of a time tag, the base unit of the ticks.
+template <class TimeTag>
+using TscSecond = CompoundUnit<double, UnitSignature<std::ratio<1>, 1, TimeTag>>;
+
+/**
+ * Raw ticks of readTsc(), e.g. TscTicks<TimeTag>{t1 - t0}.as<MilliSecond>().
+ * @tparam TimeTag the tag of the time dimension of the compound units to convert to.
+ */
+template <class TimeTag>
+using TscTicks = CalibratedUnit<std::uint64_t, TscSecond<TimeTag>, &tsc_period>;
+
+/**
+ * Read the time stamp counter.
+ * @details It is rdtsc on x86, which is not serializing, i.e. a few instructions around it may be
+ *          reordered, and the count of std::chrono::steady_clock elsewhere. The builtin is used
+ *          rather than <x86intrin.h>, which GCC 12 fails to compile in a module.
+ */
+inline std::uint64_t readTsc() noexcept
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/**
+ * Measure the period of readTsc() against std::chrono::steady_clock, and set tsc_period.
+ * @details Call it once at startup, before the ticks are converted and before the other threads
+ *          are started. It spins for the given window, the longer the more accurate.
+ * @return the period in seconds.
+ */
+inline double calibrateTsc(const std::chrono::nanoseconds window = std::chrono::milliseconds{20})
+{
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point begin{Clock::now()};
+    const std::uint64_t begin_ticks{readTsc()};
+    Clock::time_point end{begin};
+    while (end - begin < window)
+    {
+        end = Clock::now();
+    }
+    const std::uint64_t end_ticks{readTsc()};
+    const double seconds{std::chrono::duration<double>(end - begin).count()};
+    tsc_period.calibrate(seconds / static_cast<double>(end_ticks - begin_ticks));
+    return tsc_period.period();
+}
+
+/**
+ * Calibrate tsc_period with calibrateTsc(), unless it is already calibrated.
+ * @details The timers call it on construction, the raw ticks of readTsc() must call it before
+ *          as(). Only the first call may measure, the next ones are an atomic load.
+ */
+inline void ensureTscCalibrated()
+{
+    static std::once_flag once{};
+    std::call_once(once, [] {
+        if (std::isnan(tsc_period.period()))
+        {
+            calibrateTsc();
+        }
+    });
+}
+
+/**
+ * Measure the ticks elapsed since the construction or the last restart.
+ * @details elapsed() is a read of the counter and a subtraction, the conversion to a time unit is
+ *          deferred to the report, e.g. stopwatch.elapsed().as<MilliSecond_double>().
+ */
+template <class TimeTag>
+class Stopwatch
+{
+  public:
+    using Ticks = TscTicks<TimeTag>;
+
+    Stopwatch() : start_{(ensureTscCalibrated(), readTsc())} {}
+
+    void restart() noexcept { start_ = readTsc(); }
+
+    Ticks elapsed() const noexcept { return Ticks{readTsc() - start_}; }
+
+    /// @brief The ticks elapsed since the last lap, and restart.
+    Ticks lap() noexcept
+    {
+        const std::uint64_t now{readTsc()};
+        return Ticks{now - std::exchange(start_, now)};
+    }
+
+  private:
+    std::uint64_t start_;
+};
+
+/// A span recorded by a ScopedTimer, in raw ticks.
+struct RecordedSpan
+{
+    std::string_view name;
+    std::thread::id thread;
+    std::uint64_t begin;
+    std::uint64_t end;
+
+    template <class TimeTag>
+    TscTicks<TimeTag> duration() const noexcept
+    {
+        return TscTicks<TimeTag>{end - begin};
+    }
+};
+
+namespace timer_helper
+{
+/**
+ * The recorded spans of all the threads.
+ * @details Each thread appends to its own buffer without a lock, and moves it to the shared spans
+ *          under the mutex when it is full, on flushSpans() and when the thread exits.
+ */
+class SpanRegistry
+{
+  public:
+    static constexpr std::size_t kBufferSize{1024};
+
+    struct ThreadBuffer
+    {
+        ThreadBuffer() { spans.reserve(kBufferSize); }
+
+        ~ThreadBuffer() { instance().flush(spans); }
+
+        ThreadBuffer(const ThreadBuffer&) = delete;
+        ThreadBuffer& operator=(const ThreadBuffer&) = delete;
+
+        void record(const RecordedSpan& span)
+        {
+            spans.push_back(span);
+            if (spans.size() == kBufferSize) [[unlikely]]
+            {
+                instance().flush(spans);
+            }
+        }
+
+        std::vector<RecordedSpan> spans{};
+    };
+
+    static SpanRegistry& instance()
+    {
+        static SpanRegistry registry{};
+        return registry;
+    }
+
+    static ThreadBuffer& threadBuffer()
+    {
+        thread_local ThreadBuffer buffer{};
+        return buffer;
+    }
+
+    void flush(std::vector<RecordedSpan>& spans)
+    {
+        const std::lock_guard lock{mutex_};
+        spans_.insert(spans_.end(), spans.begin(), spans.end());
+        spans.clear();
+    }
+
+    std::vector<RecordedSpan> take()
+    {
+        const std::lock_guard lock{mutex_};
+        return std::exchange(spans_, {});
+    }
+
+  private:
+    SpanRegistry() = default;
+
+    std::mutex mutex_{};
+    std::vector<RecordedSpan> spans_{};
+};
+} // namespace timer_helper
+
+/**
+ * Record the span of its scope, for a profiler.
+ * @details The construction and the destruction each read the counter, and the destruction
+ *          appends the raw ticks to a buffer of the thread, so it is cheap enough for a tight
+ *          loop. The spans are collected with takeSpans().
+ * @tparam TimeTag the tag of the time dimension of elapsed().
+ */
+template <class TimeTag>
+class ScopedTimer
+{
+  public:
+    /// @param name a string which outlives the report, e.g. a literal.
+    explicit ScopedTimer(const std::string_view name)
+        : name_{name}, begin_{(ensureTscCalibrated(), readTsc())}
+    {}
+
+    ~ScopedTimer()
+    {
+        timer_helper::SpanRegistry::threadBuffer().record(
+            {name_, std::this_thread::get_id(), begin_, readTsc()});
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    TscTicks<TimeTag> elapsed() const noexcept { return TscTicks<TimeTag>{readTsc() - begin_}; }
+
+  private:
+    std::string_view name_;
+    std::uint64_t begin_;
+};
+
+/// Move the buffered spans of the calling thread to the ones of takeSpans().
+inline void flushSpans()
+{
+    timer_helper::SpanRegistry::instance().flush(
+        timer_helper::SpanRegistry::threadBuffer().spans);
+}
+
+/**
+ * Take the recorded spans, the ones of the calling thread included.
+ * @details The spans still buffered by the other running threads are not included, until they are
+ *          full or the threads call flushSpans() or exit.
+ */
+inline std::vector<RecordedSpan> takeSpans()
+{
+    flushSpans();
+    return timer_helper::SpanRegistry::instance().take();
+}
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_TIMER_H_
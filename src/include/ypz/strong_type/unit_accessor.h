@@ -0,0 +1,100 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_ACCESSOR_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_ACCESSOR_H_
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <version>
+#if defined(__cpp_lib_mdspan)
+#include <mdspan>
+#endif
+
+#include "ypz/strong_type/compound_unit.h"
+
+namespace cpu
+{
+/**
+ * mdspan accessor policy, which views a buffer of counts of FromCU as values of ToCU.
+ * @details The buffer is not converted up front, each access casts one count with the compile
+ *          time scaling ratio of castAs, so a slice of a large grid is read without a copy. The
+ *          reference is a value, i.e. the view is read-only.
+ *          It satisfies the AccessorPolicy requirements of std::mdspan, e.g.
+ *          std::mdspan<const KmPerHour, Extents, std::layout_right,
+ *                      unit_accessor<MeterPerSecond_double, KmPerHour>>
+ * @tparam FromCU the compound unit of the counts in the buffer.
+ * @tparam ToCU the compound unit of the elements of the view, castable from FromCU.
+ */
+template <CompoundUnitConcept FromCU, CompoundUnitConcept ToCU = FromCU>
+requires(compound_unit_helper::are_compound_units_castable_v<ToCU, FromCU>)
+struct unit_accessor
+{
+    using offset_policy = unit_accessor;
+    using element_type = const ToCU;
+    using reference = ToCU;
+    using data_handle_type = const typename FromCU::Rep*;
+
+    constexpr unit_accessor() noexcept = default;
+
+    constexpr reference access(const data_handle_type p, const std::size_t i) const noexcept
+    {
+        return ToCU{FromCU{p[i]}};
+    }
+
+    constexpr data_handle_type offset(const data_handle_type p, const std::size_t i) const noexcept
+    {
+        return p + i;
+    }
+};
+
+/**
+ * mdspan accessor policy, which views a buffer of counts as compound units of their own period.
+ * @details The access is a pure reinterpret of the count as CU, which has the same size and
+ *          layout as its rep, so the view is writable and costs nothing over the raw buffer.
+ * @tparam CU the compound unit of the counts, const for a read-only view.
+ */
+template <class CU>
+requires(CompoundUnitConcept<std::remove_const_t<CU>>)
+struct native_unit_accessor
+{
+    static_assert(sizeof(CU) == sizeof(typename CU::Rep) && std::is_standard_layout_v<CU>,
+                  "The compound unit shall have the layout of its rep.");
+
+    using offset_policy = native_unit_accessor;
+    using element_type = CU;
+    using reference = CU&;
+    using data_handle_type =
+        std::conditional_t<std::is_const_v<CU>, const typename CU::Rep*, typename CU::Rep*>;
+
+    constexpr native_unit_accessor() noexcept = default;
+
+    /// @brief Convert from the accessor of a non-const CU to the accessor of a const CU.
+    template <class OtherCU>
+    requires(std::is_convertible_v<OtherCU (*)[], CU (*)[]>)
+    constexpr native_unit_accessor(native_unit_accessor<OtherCU>) noexcept
+    {}
+
+    reference access(const data_handle_type p, const std::size_t i) const noexcept
+    {
+        return reinterpret_cast<CU*>(p)[i];
+    }
+
+    constexpr data_handle_type offset(const data_handle_type p, const std::size_t i) const noexcept
+    {
+        return p + i;
+    }
+};
+
+#if defined(__cpp_lib_mdspan)
+/// mdspan of ToCU over a buffer of counts of FromCU, scaled on access.
+template <CompoundUnitConcept ToCU, class Extents, CompoundUnitConcept FromCU = ToCU,
+          class Layout = std::layout_right>
+using unit_mdspan = std::mdspan<const ToCU, Extents, Layout, unit_accessor<FromCU, ToCU>>;
+
+/// mdspan of CU over a buffer of its counts.
+template <class CU, class Extents, class Layout = std::layout_right>
+using native_unit_mdspan = std::mdspan<CU, Extents, Layout, native_unit_accessor<CU>>;
+#endif
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_ACCESSOR_H_
@@ -0,0 +1,378 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_ARRAY_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_ARRAY_H_
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/number.h"
+
+namespace cpu
+{
+/**
+ * Allocator adaptor whose value-initialization is a default-initialization.
+ * @details E.g. std::vector<Meter_double, DefaultInitAllocator<Meter_double>>(n) and resize(n)
+ *          leave the new elements uninitialized, constructed with cpu::uninit for compound units,
+ *          so that a large buffer is neither zero-filled nor touched before it is written, e.g.
+ *          by I/O or a parallel first touch. The other constructions are forwarded to Alloc.
+ */
+template <class T, class Alloc = std::allocator<T>>
+class DefaultInitAllocator : public Alloc
+{
+    using Traits = std::allocator_traits<Alloc>;
+
+  public:
+    template <class U>
+    struct rebind
+    {
+        using other = DefaultInitAllocator<U, typename Traits::template rebind_alloc<U>>;
+    };
+
+    using Alloc::Alloc;
+
+    template <class U>
+    void construct(U* const p) noexcept(std::is_nothrow_default_constructible_v<U>)
+    {
+        if constexpr (std::is_constructible_v<U, uninit_t>)
+        {
+            ::new (static_cast<void*>(p)) U(uninit);
+        }
+        else
+        {
+            ::new (static_cast<void*>(p)) U;
+        }
+    }
+
+    template <class U, class... Args>
+    void construct(U* const p, Args&&... args)
+    {
+        Traits::construct(static_cast<Alloc&>(*this), p, std::forward<Args>(args)...);
+    }
+};
+
+template <CompoundUnitConcept CU>
+class UnitArray;
+
+namespace unit_array_helper
+{
+/// Base of the types which can be evaluated element-wise into a UnitArray.
+struct ArrayExprTag
+{
+};
+
+/// Concept for an array expression, i.e. a UnitArray or a lazy element-wise operation.
+template <class T>
+concept ArrayExprConcept = std::derived_from<T, ArrayExprTag>;
+
+/// Concept for an operand of an element-wise operation, a scalar is broadcast to every element.
+template <class T>
+concept OperandConcept =
+    ArrayExprConcept<T> || CompoundUnitConcept<T> || number_helper::SignedNumberConcept<T>;
+
+/// The element type of an operand.
+///@{
+template <OperandConcept T>
+struct element
+{
+    using type = T;
+};
+
+template <ArrayExprConcept T>
+struct element<T>
+{
+    using type = typename T::Unit;
+};
+
+template <OperandConcept T>
+using element_t = typename element<T>::type;
+///@}
+
+/// Get the element at `idx` of an operand.
+template <OperandConcept T>
+constexpr element_t<T> elementAt(const T& operand, const std::size_t idx)
+{
+    if constexpr (ArrayExprConcept<T>)
+    {
+        return operand.at(idx);
+    }
+    else
+    {
+        return operand;
+    }
+}
+
+/// Arrays are stored by reference in an expression, other operands by value.
+///@{
+template <OperandConcept T>
+struct stored
+{
+    using type = T;
+};
+
+template <CompoundUnitConcept CU>
+struct stored<UnitArray<CU>>
+{
+    using type = const UnitArray<CU>&;
+};
+
+template <OperandConcept T>
+using stored_t = typename stored<T>::type;
+///@}
+
+/**
+ * Concept for a valid element-wise operation.
+ * @details At least one operand is an array expression, and the operation of the elements must
+ *          return a compound unit by the unit algebra of compound units.
+ */
+template <class Op, class... Ts>
+concept ElementWiseConcept =
+    (OperandConcept<Ts> && ...) && (ArrayExprConcept<Ts> || ...) &&
+    std::is_invocable_v<Op, element_t<Ts>...> &&
+    CompoundUnitConcept<std::remove_cvref_t<std::invoke_result_t<Op, element_t<Ts>...>>>;
+
+/**
+ * Lazy element-wise binary operation, e.g. lhs + rhs.
+ * @details The element at `idx` is computed on access by the operators of compound units, so the
+ *          unit algebra and the period scaling are resolved at compile time, and a whole
+ *          expression is evaluated in one pass without temporary arrays.
+ */
+template <class Op, OperandConcept L, OperandConcept R>
+requires(ElementWiseConcept<Op, L, R>)
+class BinaryExpr : public ArrayExprTag
+{
+  public:
+    /// @brief The compound unit of each element.
+    using Unit = std::remove_cvref_t<std::invoke_result_t<Op, element_t<L>, element_t<R>>>;
+
+    constexpr BinaryExpr(const L& lhs, const R& rhs) : lhs_{lhs}, rhs_{rhs} {}
+
+    /// @brief The number of elements.
+    constexpr std::size_t size() const
+    {
+        if constexpr (ArrayExprConcept<L>)
+        {
+            return lhs_.size();
+        }
+        else
+        {
+            return rhs_.size();
+        }
+    }
+
+    /// @brief The element at `idx`.
+    constexpr Unit at(const std::size_t idx) const
+    {
+        return Op{}(elementAt(lhs_, idx), elementAt(rhs_, idx));
+    }
+
+  private:
+    stored_t<L> lhs_;
+    stored_t<R> rhs_;
+};
+
+/// Lazy element-wise unary operation, e.g. -operand.
+template <class Op, ArrayExprConcept T>
+requires(ElementWiseConcept<Op, T>)
+class UnaryExpr : public ArrayExprTag
+{
+  public:
+    /// @brief The compound unit of each element.
+    using Unit = std::remove_cvref_t<std::invoke_result_t<Op, element_t<T>>>;
+
+    explicit constexpr UnaryExpr(const T& operand) : operand_{operand} {}
+
+    /// @brief The number of elements.
+    constexpr std::size_t size() const { return operand_.size(); }
+
+    /// @brief The element at `idx`.
+    constexpr Unit at(const std::size_t idx) const { return Op{}(operand_.at(idx)); }
+
+  private:
+    stored_t<T> operand_;
+};
+} // namespace unit_array_helper
+
+/**
+ * Dynamically sized array of compound units, with element-wise expression templates.
+ * @details The arithmetic operators of arrays do not compute anything, but build a lazy
+ *          expression, e.g. pos + vel * dt + 0.5 * acc * dt * dt, which is checked by the unit
+ *          algebra at compile time. The expression is evaluated in one fused loop when it is
+ *          assigned to a UnitArray, with the period ratios as compile time constants and
+ *          without intermediate arrays.
+ *          An expression refers to the arrays in it, so it shall not outlive them.
+ * @tparam CU the compound unit of each element.
+ */
+template <CompoundUnitConcept CU>
+class UnitArray : public unit_array_helper::ArrayExprTag
+{
+  public:
+    /// @brief The compound unit of each element.
+    using Unit = CU;
+
+    /// @brief The underlying representation type.
+    using Rep = typename CU::Rep;
+
+    /// @brief Constructors.
+    ///@{
+    /// @brief Construct an empty array.
+    UnitArray() = default;
+
+    /// @brief Construct `size` elements of `value`.
+    explicit UnitArray(const std::size_t size, const CU value = CU{}) : values_(size, value) {}
+
+    /// @brief Construct `size` uninitialized elements.
+    UnitArray(const std::size_t size, uninit_t) : values_(size) {}
+
+    /// @brief Construct by evaluating an array expression of a castable unit. With
+    ///        CPU_STRONG_TYPE_STRICT defined, it is explicit unless the conversion of the elements
+    ///        is the identity, like the converting constructor of CompoundUnit.
+    template <unit_array_helper::ArrayExprConcept Expr>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, typename Expr::Unit>)
+    explicit(compound_unit_helper::is_explicit_conversion_v<typename Expr::Unit, CU>)
+        UnitArray(const Expr& expr)
+    {
+        assign(expr);
+    }
+    ///@}
+
+    /// @brief Evaluate an array expression of a castable unit into this array. With
+    ///        CPU_STRONG_TYPE_STRICT defined, only the expressions of CU itself are assigned, the
+    ///        others are converted with the explicit constructor.
+    ///@{
+    template <unit_array_helper::ArrayExprConcept Expr>
+    requires(compound_unit_helper::are_compound_units_castable_v<CU, typename Expr::Unit> &&
+             !compound_unit_helper::is_explicit_conversion_v<typename Expr::Unit, CU>)
+    UnitArray& operator=(const Expr& expr)
+    {
+        assign(expr);
+        return *this;
+    }
+
+    template <unit_array_helper::OperandConcept T>
+    requires(unit_array_helper::ElementWiseConcept<std::plus<>, UnitArray, T> &&
+             !compound_unit_helper::is_explicit_conversion_v<
+                 typename unit_array_helper::BinaryExpr<std::plus<>, UnitArray, T>::Unit, CU>)
+    UnitArray& operator+=(const T& operand)
+    {
+        assign(unit_array_helper::BinaryExpr<std::plus<>, UnitArray, T>{*this, operand});
+        return *this;
+    }
+
+    template <unit_array_helper::OperandConcept T>
+    requires(unit_array_helper::ElementWiseConcept<std::minus<>, UnitArray, T> &&
+             !compound_unit_helper::is_explicit_conversion_v<
+                 typename unit_array_helper::BinaryExpr<std::minus<>, UnitArray, T>::Unit, CU>)
+    UnitArray& operator-=(const T& operand)
+    {
+        assign(unit_array_helper::BinaryExpr<std::minus<>, UnitArray, T>{*this, operand});
+        return *this;
+    }
+    ///@}
+
+    /// @brief The number of elements.
+    std::size_t size() const { return values_.size(); }
+
+    /// @brief Resize, new elements are zero.
+    void resize(const std::size_t size) { values_.resize(size, CU{}); }
+
+    /// @brief Resize, new elements are uninitialized.
+    void resize(const std::size_t size, uninit_t) { values_.resize(size); }
+
+    /// @brief Access the element at `idx`.
+    ///@{
+    CU& operator[](const std::size_t idx) { return values_[idx]; }
+
+    const CU& operator[](const std::size_t idx) const { return values_[idx]; }
+
+    const CU& at(const std::size_t idx) const { return values_[idx]; }
+    ///@}
+
+    /// @brief Contiguous access to the elements.
+    ///@{
+    CU* data() { return values_.data(); }
+
+    const CU* data() const { return values_.data(); }
+
+    CU* begin() { return values_.data(); }
+
+    const CU* begin() const { return values_.data(); }
+
+    CU* end() { return values_.data() + values_.size(); }
+
+    const CU* end() const { return values_.data() + values_.size(); }
+    ///@}
+
+  private:
+    /// Evaluate an expression in one pass. Aliasing this array is fine, since every element only
+    /// depends on the elements of the operands at the same index.
+    template <unit_array_helper::ArrayExprConcept Expr>
+    void assign(const Expr& expr)
+    {
+        const std::size_t size{expr.size()};
+        if (size != values_.size())
+        {
+            values_.resize(size);
+        }
+        CU* const out{values_.data()};
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            out[i] = CU{expr.at(i)};
+        }
+    }
+
+    std::vector<CU, DefaultInitAllocator<CU>> values_{};
+};
+
+/**
+ * Element-wise operators of array expressions, scalars and compound units.
+ * @details The element type follows the unit algebra, e.g.
+ *          UnitArray<MeterPerSecond> * Second => an expression of Meter.
+ * @pre The array operands must have the same size.
+ */
+///@{
+template <class L, class R>
+requires(unit_array_helper::ElementWiseConcept<std::plus<>, L, R>)
+constexpr auto operator+(const L& lhs, const R& rhs)
+{
+    return unit_array_helper::BinaryExpr<std::plus<>, L, R>{lhs, rhs};
+}
+
+template <class L, class R>
+requires(unit_array_helper::ElementWiseConcept<std::minus<>, L, R>)
+constexpr auto operator-(const L& lhs, const R& rhs)
+{
+    return unit_array_helper::BinaryExpr<std::minus<>, L, R>{lhs, rhs};
+}
+
+template <class L, class R>
+requires(unit_array_helper::ElementWiseConcept<std::multiplies<>, L, R>)
+constexpr auto operator*(const L& lhs, const R& rhs)
+{
+    return unit_array_helper::BinaryExpr<std::multiplies<>, L, R>{lhs, rhs};
+}
+
+template <class L, class R>
+requires(unit_array_helper::ElementWiseConcept<std::divides<>, L, R>)
+constexpr auto operator/(const L& lhs, const R& rhs)
+{
+    return unit_array_helper::BinaryExpr<std::divides<>, L, R>{lhs, rhs};
+}
+
+template <unit_array_helper::ArrayExprConcept T>
+requires(unit_array_helper::ElementWiseConcept<std::negate<>, T>)
+constexpr auto operator-(const T& operand)
+{
+    return unit_array_helper::UnaryExpr<std::negate<>, T>{operand};
+}
+///@}
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_ARRAY_H_
@@ -0,0 +1,213 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_TABLE_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_TABLE_H_
+
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/type.h"
+
+namespace cpu
+{
+/**
+ * Column declaration of a UnitTable.
+ * @tparam _Name the tag type naming the column.
+ * @tparam _Unit the compound unit of the values in the column.
+ */
+template <class _Name, CompoundUnitConcept _Unit>
+struct Column
+{
+    using Name = _Name;
+    using Unit = _Unit;
+};
+
+/// Concept for Column.
+template <class T>
+concept ColumnConcept = type_helper::is_specialization_v<T, Column>;
+
+/**
+ * Table of records stored as struct of arrays, i.e. one contiguous array per column.
+ * @details E.g. UnitTable<Column<Position, Meter>, Column<Velocity, MeterPerSecond>> stores
+ *          the positions and velocities in two separate arrays. Column-wise kernels (update,
+ *          accumulate) only stream the columns they name, and the unit algebra of the kernels
+ *          is resolved at compile time.
+ * @tparam Columns the column declarations.
+ * @pre The names of the columns must be unique.
+ */
+template <ColumnConcept... Columns>
+requires(sizeof...(Columns) > 0)
+class UnitTable
+{
+    static_assert(
+        type_helper::is_each_type_unique<type_helper::TypeList<typename Columns::Name...>>,
+        "The names of the columns shall be unique.");
+
+  public:
+    /// @brief The names of the columns.
+    using Names = type_helper::TypeList<typename Columns::Name...>;
+
+    /// @brief The compound units of the columns.
+    using Units = type_helper::TypeList<typename Columns::Unit...>;
+
+    /// @brief The index of the column named `Name`.
+    template <class Name>
+    requires(Names::template has_type<Name>)
+    static constexpr std::size_t index_of{*type_helper::pos_of_type_v<Names, Name>};
+
+    /// @brief The compound unit of the column named `Name`.
+    template <class Name>
+    using unit_of = typename Units::template type_at<index_of<Name>>;
+
+    /**
+     * Reference to one row of a table.
+     * @details get<Name>() returns a reference to the compound unit in the column.
+     */
+    template <class Table>
+    class RowRef
+    {
+      public:
+        RowRef(Table& table, const std::size_t row) : table_{&table}, row_{row} {}
+
+        template <class Name>
+        auto& get() const
+        {
+            return table_->template column<Name>()[row_];
+        }
+
+        template <std::size_t I>
+        auto& get() const
+        {
+            return table_->template column<I>()[row_];
+        }
+
+      private:
+        Table* table_;
+        std::size_t row_;
+    };
+
+    /// @brief Construct with `size` rows of zeros.
+    explicit UnitTable(const std::size_t size = 0) { resize(size); }
+
+    /// @brief The number of rows.
+    std::size_t size() const { return std::get<0>(columns_).size(); }
+
+    /// @brief Resize, new rows are zero.
+    void resize(const std::size_t size)
+    {
+        std::apply([size](auto&... column) { (column.resize(size), ...); }, columns_);
+    }
+
+    /// @brief Reserve capacity for `capacity` rows.
+    void reserve(const std::size_t capacity)
+    {
+        std::apply([capacity](auto&... column) { (column.reserve(capacity), ...); }, columns_);
+    }
+
+    /// @brief Append a row of castable compound units, in the order of the columns.
+    template <CompoundUnitConcept... Us>
+    requires(sizeof...(Us) == sizeof...(Columns) &&
+             (compound_unit_helper::are_compound_units_castable_v<typename Columns::Unit, Us> &&
+              ...))
+    void push_back(const Us&... values)
+    {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (std::get<Is>(columns_).emplace_back(values), ...);
+        }(std::index_sequence_for<Us...>());
+    }
+
+    /// @brief Typed span of the column named `Name`.
+    ///@{
+    template <class Name>
+    std::span<unit_of<Name>> column()
+    {
+        return std::get<index_of<Name>>(columns_);
+    }
+
+    template <class Name>
+    std::span<const unit_of<Name>> column() const
+    {
+        return std::get<index_of<Name>>(columns_);
+    }
+    ///@}
+
+    /// @brief Typed span of the column at index `I`.
+    ///@{
+    template <std::size_t I>
+    std::span<typename Units::template type_at<I>> column()
+    {
+        return std::get<I>(columns_);
+    }
+
+    template <std::size_t I>
+    std::span<const typename Units::template type_at<I>> column() const
+    {
+        return std::get<I>(columns_);
+    }
+    ///@}
+
+    /// @brief Reference to the row at `row`.
+    ///@{
+    RowRef<UnitTable> operator[](const std::size_t row) { return {*this, row}; }
+
+    RowRef<const UnitTable> operator[](const std::size_t row) const { return {*this, row}; }
+    ///@}
+
+    /**
+     * Column-wise update: out[row] = op(in0[row], in1[row], ...) for each row.
+     * @details E.g. update<Position, Position, Velocity>([dt](auto p, auto v) {
+     *                   return p + v * dt; });
+     *          Only the named columns are streamed. The result of op must be castable to the
+     *          unit of the output column, which is checked at compile time.
+     * @tparam OutName the name of the column to write.
+     * @tparam InNames the names of the columns to read.
+     */
+    template <class OutName, class... InNames, class Op>
+    void update(Op op)
+    {
+        using OutUnit = unit_of<OutName>;
+        using ResultType = std::remove_cvref_t<std::invoke_result_t<Op, unit_of<InNames>...>>;
+        static_assert(CompoundUnitConcept<ResultType> &&
+                          compound_unit_helper::are_compound_units_castable_v<OutUnit, ResultType>,
+                      "The result of the update shall be castable to the output column.");
+
+        const std::span<OutUnit> out{column<OutName>()};
+        const std::tuple<std::span<const unit_of<InNames>>...> ins{
+            std::as_const(*this).template column<InNames>()...};
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            for (std::size_t row{0}; row < out.size(); ++row)
+            {
+                out[row] = OutUnit{op(std::get<Is>(ins)[row]...)};
+            }
+        }(std::index_sequence_for<InNames...>());
+    }
+
+    /**
+     * Column-wise reduction: init = op(init, in0[row], in1[row], ...) for each row.
+     * @details E.g. accumulate<Mass, Velocity>(Momentum{}, [](auto p, auto m, auto v) {
+     *                   return p + m * v; });
+     * @tparam InNames the names of the columns to read.
+     */
+    template <class... InNames, class T, class Op>
+    T accumulate(T init, Op op) const
+    {
+        const std::tuple<std::span<const unit_of<InNames>>...> ins{column<InNames>()...};
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            for (std::size_t row{0}; row < size(); ++row)
+            {
+                init = op(init, std::get<Is>(ins)[row]...);
+            }
+        }(std::index_sequence_for<InNames...>());
+        return init;
+    }
+
+  private:
+    std::tuple<std::vector<typename Columns::Unit>...> columns_{};
+};
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_TABLE_H_
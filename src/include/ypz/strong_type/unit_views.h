@@ -0,0 +1,239 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_VIEWS_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_VIEWS_H_
+
+#include <concepts>
+#include <ranges>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/number.h"
+
+namespace cpu
+{
+namespace views_helper
+{
+/**
+ * The element-wise function of a fused unit view: the count of the element in Source, scaled by
+ * Ratio, as a Target or its count.
+ * @details The element is a Source or a raw number (as_unit). The compile time ratios of the
+ *          chained adaptors are combined into Factor, which is applied like castAs, but with one
+ *          multiply for a floating point rep.
+ */
+template <CompoundUnitConcept Source, CompoundUnitConcept Target, class Ratio, bool AsCount>
+struct Scale
+{
+    using Factor =
+        std::ratio_multiply<std::ratio_divide<typename Source::Period, typename Target::Period>,
+                            Ratio>;
+    using TargetRep = typename Target::Rep;
+    using Result = std::conditional_t<AsCount, TargetRep, Target>;
+
+    template <class Element>
+    constexpr Result operator()(const Element& element) const
+    {
+        const auto count = [&element] {
+            if constexpr (CompoundUnitConcept<Element>)
+            {
+                return number_helper::widen(element.count());
+            }
+            else
+            {
+                return number_helper::widen(element);
+            }
+        }();
+        using CommonRep =
+            std::common_type_t<decltype(count), number_helper::compute_rep_t<TargetRep>>;
+
+        CommonRep value{static_cast<CommonRep>(count)};
+        if constexpr (std::floating_point<CommonRep>)
+        {
+            constexpr CommonRep kFactor{static_cast<CommonRep>(Factor::num) /
+                                        static_cast<CommonRep>(Factor::den)};
+            value *= kFactor;
+        }
+        else
+        {
+            value = value * static_cast<CommonRep>(Factor::num) /
+                    static_cast<CommonRep>(Factor::den);
+        }
+
+        const TargetRep ret{number_helper::narrow<TargetRep>(value)};
+        if constexpr (AsCount)
+        {
+            return ret;
+        }
+        else
+        {
+            return Target{ret};
+        }
+    }
+};
+
+/// A unit view, i.e. a transform view by a Scale, whose adaptors are fused into the Scale.
+///@{
+template <class T>
+struct fused_view_traits
+{
+    static constexpr bool is_fused{false};
+};
+
+template <class V, CompoundUnitConcept Source, CompoundUnitConcept Target, class Ratio,
+          bool AsCount>
+struct fused_view_traits<std::ranges::transform_view<V, Scale<Source, Target, Ratio, AsCount>>>
+{
+    static constexpr bool is_fused{true};
+    using Base = V;
+    using Src = Source;
+    using Tgt = Target;
+    using Rto = Ratio;
+    static constexpr bool as_count{AsCount};
+};
+
+template <class R>
+using fused_traits_t = fused_view_traits<std::remove_cvref_t<R>>;
+
+/// The view of Scale over the base of a fused view R.
+template <class NewScale, class R>
+constexpr auto refuse(R&& range)
+{
+    using Base = typename fused_traits_t<R>::Base;
+    return std::ranges::transform_view<Base, NewScale>{std::forward<R>(range).base(), NewScale{}};
+}
+
+/// The view of Scale over any viewable range R.
+template <class NewScale, std::ranges::viewable_range R>
+constexpr auto fuse(R&& range)
+{
+    return std::ranges::transform_view{std::views::all(std::forward<R>(range)), NewScale{}};
+}
+///@}
+
+/// Concept for a viewable range of compound units.
+template <class R>
+concept UnitRangeConcept =
+    std::ranges::viewable_range<R> &&
+    CompoundUnitConcept<std::remove_cvref_t<std::ranges::range_reference_t<R>>>;
+
+/// The compound unit of the elements of a unit range.
+template <UnitRangeConcept R>
+using range_unit_t = std::remove_cvref_t<std::ranges::range_reference_t<R>>;
+
+/// Base of the range adaptor closures, which pipe as range | closure.
+template <class Closure>
+struct AdaptorClosure
+{
+    template <std::ranges::viewable_range R>
+    requires std::invocable<const Closure&, R>
+    friend constexpr auto operator|(R&& range, const Closure& closure)
+    {
+        return closure(std::forward<R>(range));
+    }
+};
+
+template <CompoundUnitConcept To>
+struct UnitCastClosure : AdaptorClosure<UnitCastClosure<To>>
+{
+    template <UnitRangeConcept R>
+    requires(compound_unit_helper::are_compound_units_castable_v<To, range_unit_t<R>>)
+    constexpr auto operator()(R&& range) const
+    {
+        using Traits = fused_traits_t<R>;
+        if constexpr (Traits::is_fused)
+        {
+            return refuse<Scale<typename Traits::Src, To, typename Traits::Rto, false>>(
+                std::forward<R>(range));
+        }
+        else
+        {
+            return fuse<Scale<range_unit_t<R>, To, std::ratio<1>, false>>(std::forward<R>(range));
+        }
+    }
+};
+
+template <CompoundUnitConcept CU>
+struct AsUnitClosure : AdaptorClosure<AsUnitClosure<CU>>
+{
+    template <std::ranges::viewable_range R>
+    requires(number_helper::RepConcept<std::remove_cvref_t<std::ranges::range_reference_t<R>>>)
+    constexpr auto operator()(R&& range) const
+    {
+        return fuse<Scale<CU, CU, std::ratio<1>, false>>(std::forward<R>(range));
+    }
+};
+
+struct CountClosure : AdaptorClosure<CountClosure>
+{
+    template <UnitRangeConcept R>
+    constexpr auto operator()(R&& range) const
+    {
+        using Traits = fused_traits_t<R>;
+        if constexpr (Traits::is_fused)
+        {
+            return refuse<
+                Scale<typename Traits::Src, typename Traits::Tgt, typename Traits::Rto, true>>(
+                std::forward<R>(range));
+        }
+        else
+        {
+            using CU = range_unit_t<R>;
+            return fuse<Scale<CU, CU, std::ratio<1>, true>>(std::forward<R>(range));
+        }
+    }
+};
+
+template <class Ratio>
+struct ScaleClosure : AdaptorClosure<ScaleClosure<Ratio>>
+{
+    template <std::ranges::viewable_range R>
+    requires(UnitRangeConcept<R> || fused_traits_t<R>::is_fused)
+    constexpr auto operator()(R&& range) const
+    {
+        using Traits = fused_traits_t<R>;
+        if constexpr (Traits::is_fused)
+        {
+            return refuse<Scale<typename Traits::Src, typename Traits::Tgt,
+                                std::ratio_multiply<typename Traits::Rto, Ratio>,
+                                Traits::as_count>>(std::forward<R>(range));
+        }
+        else
+        {
+            using CU = range_unit_t<R>;
+            return fuse<Scale<CU, CU, Ratio, false>>(std::forward<R>(range));
+        }
+    }
+};
+} // namespace views_helper
+
+/**
+ * Lazy range adaptors between compound units and their counts, e.g.
+ *     samples | cpu::views::as_unit<MeterPerSecond_double> | cpu::views::unit_cast<KmPerHour>
+ * @details A chain of these adaptors is one std::ranges::transform_view over the original range,
+ *          whose compile time ratios are combined, so that each element is one multiply (or one
+ *          multiply and one divide for an integer rep) instead of one per adaptor. Hence an
+ *          integer chain may round less than the same casts one by one. The view is sized and
+ *          random access like the range, and iterates its iterators directly, e.g. the pointers
+ *          of a contiguous range, so that the loops over it vectorize.
+ */
+namespace views
+{
+/// Cast the compound units to To.
+template <CompoundUnitConcept To>
+inline constexpr views_helper::UnitCastClosure<To> unit_cast{};
+
+/// View the raw numbers as counts of CU.
+template <CompoundUnitConcept CU>
+inline constexpr views_helper::AsUnitClosure<CU> as_unit{};
+
+/// View the counts of the compound units.
+inline constexpr views_helper::CountClosure count{};
+
+/// Scale the compound units, or the counts, by Ratio, e.g. scale<std::ratio<1, 2>> to halve.
+template <class Ratio>
+inline constexpr views_helper::ScaleClosure<Ratio> scale{};
+} // namespace views
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_UNIT_VIEWS_H_
@@ -0,0 +1,363 @@
+#ifndef SRC_INCLUDE_YPZ_STRONG_TYPE_VEC_H_
+#define SRC_INCLUDE_YPZ_STRONG_TYPE_VEC_H_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/helpers/number.h"
+#include "ypz/strong_type/helpers/type.h"
+
+namespace cpu
+{
+namespace vec_helper
+{
+/// Small vectors are padded to a power of two lanes, so that they fill a SIMD register.
+template <std::size_t N>
+constexpr std::size_t lanes_v{N <= 8 ? std::bit_ceil(N) : N};
+
+template <class Rep, std::size_t N>
+constexpr std::size_t alignment_v{std::has_single_bit(sizeof(Rep) * lanes_v<N>)
+                                      ? std::min<std::size_t>(sizeof(Rep) * lanes_v<N>, 64U)
+                                      : alignof(Rep)};
+
+/// The result element type of a binary operation, which must be a compound unit.
+template <class L, class R, class Op>
+using result_unit_t = std::remove_cvref_t<std::invoke_result_t<Op, L, R>>;
+} // namespace vec_helper
+
+/**
+ * Small vector of compound units, e.g. a position or velocity in 3D.
+ * @details The counts are stored contiguously in an aligned array, small vectors are padded
+ *          with zero lanes to a power of two (e.g. 3 -> 4), so that the element-wise operators
+ *          map onto full SIMD registers.
+ * @tparam CU the compound unit of each element.
+ * @tparam N the number of elements.
+ */
+template <CompoundUnitConcept CU, std::size_t N>
+requires(N > 0)
+class alignas(vec_helper::alignment_v<typename CU::Rep, N>) Vec
+{
+  public:
+    /// @brief The compound unit of each element.
+    using Unit = CU;
+
+    /// @brief The underlying representation type.
+    using Rep = typename CU::Rep;
+
+    /// @brief Constructors.
+    ///@{
+    /// @brief Default constructor, all elements are zero.
+    explicit constexpr Vec() : counts_{} {}
+
+    /// @brief Construct from N castable compound units.
+    template <CompoundUnitConcept... Us>
+    requires(sizeof...(Us) == N &&
+             (compound_unit_helper::are_compound_units_castable_v<CU, Us> && ...))
+    explicit constexpr Vec(const Us&... values) : counts_{CU{values}.count()...}
+    {}
+
+    /// @brief Construct from another castable vector. With CPU_STRONG_TYPE_STRICT defined, it is
+    ///        explicit unless the conversion is the identity, like the one of CompoundUnit.
+    template <CompoundUnitConcept XU>
+    requires(!std::same_as<XU, CU> && compound_unit_helper::are_compound_units_castable_v<CU, XU>)
+    constexpr explicit(compound_unit_helper::is_explicit_conversion_v<XU, CU>)
+        Vec(const Vec<XU, N>& from)
+        : counts_{}
+    {
+        for (std::size_t i{0}; i < N; ++i)
+        {
+            counts_[i] = CU{from[i]}.count();
+        }
+    }
+    ///@}
+
+    /// @brief The number of elements.
+    static constexpr std::size_t size() { return N; }
+
+    /// @brief The number of elements including the zero padding lanes.
+    static constexpr std::size_t padded_size() { return vec_helper::lanes_v<N>; }
+
+    /// @brief Get the element at `idx`.
+    constexpr CU operator[](const std::size_t idx) const { return CU{counts_[idx]}; }
+
+    /// @brief Set the element at `idx`.
+    constexpr void set(const std::size_t idx, const CU value) { counts_[idx] = value.count(); }
+
+    /// @brief Get the counts of all padded lanes. The padding lanes must be kept zero.
+    ///@{
+    constexpr Rep* data() { return counts_.data(); }
+
+    constexpr const Rep* data() const { return counts_.data(); }
+    ///@}
+
+    constexpr bool operator==(const Vec&) const = default;
+
+  private:
+    std::array<Rep, vec_helper::lanes_v<N>> counts_;
+};
+
+namespace vec_helper
+{
+/// Apply a binary operator of compound units element-wise on all lanes.
+template <CompoundUnitConcept L, CompoundUnitConcept R, std::size_t N, class Op>
+constexpr auto zip(const Vec<L, N>& lhs, const Vec<R, N>& rhs, Op op)
+{
+    using ResultUnit = result_unit_t<L, R, Op>;
+    static_assert(CompoundUnitConcept<ResultUnit>, "The element type must be a compound unit.");
+
+    Vec<ResultUnit, N> ret{};
+    for (std::size_t i{0}; i < Vec<ResultUnit, N>::padded_size(); ++i)
+    {
+        ret.data()[i] = op(L{lhs.data()[i]}, R{rhs.data()[i]}).count();
+    }
+    return ret;
+}
+
+/// Apply a unary operator of compound units element-wise on all lanes.
+template <CompoundUnitConcept L, std::size_t N, class Op>
+constexpr auto map(const Vec<L, N>& lhs, Op op)
+{
+    using ResultUnit = std::remove_cvref_t<std::invoke_result_t<Op, L>>;
+    static_assert(CompoundUnitConcept<ResultUnit>, "The element type must be a compound unit.");
+
+    Vec<ResultUnit, N> ret{};
+    for (std::size_t i{0}; i < Vec<ResultUnit, N>::padded_size(); ++i)
+    {
+        ret.data()[i] = op(L{lhs.data()[i]}).count();
+    }
+    return ret;
+}
+} // namespace vec_helper
+
+/// Operator+ and operator- of two vectors of castable units.
+///@{
+template <CompoundUnitConcept L, CompoundUnitConcept R, std::size_t N>
+requires(compound_unit_helper::are_compound_units_castable_v<L, R>)
+constexpr auto operator+(const Vec<L, N>& lhs, const Vec<R, N>& rhs)
+{
+    return vec_helper::zip(lhs, rhs, [](const L& l, const R& r) { return l + r; });
+}
+
+template <CompoundUnitConcept L, CompoundUnitConcept R, std::size_t N>
+requires(compound_unit_helper::are_compound_units_castable_v<L, R>)
+constexpr auto operator-(const Vec<L, N>& lhs, const Vec<R, N>& rhs)
+{
+    return vec_helper::zip(lhs, rhs, [](const L& l, const R& r) { return l - r; });
+}
+///@}
+
+/// Unary operator- of a vector.
+template <CompoundUnitConcept CU, std::size_t N>
+constexpr auto operator-(const Vec<CU, N>& operand)
+{
+    return vec_helper::map(operand, [](const CU& x) { return -x; });
+}
+
+/// Operator* and operator/ of a vector and a scalar.
+///@{
+template <CompoundUnitConcept L, std::size_t N, number_helper::SignedNumberConcept S>
+constexpr auto operator*(const Vec<L, N>& lhs, const S rhs)
+{
+    return vec_helper::map(lhs, [rhs](const L& l) { return l * rhs; });
+}
+
+template <number_helper::SignedNumberConcept S, CompoundUnitConcept R, std::size_t N>
+constexpr auto operator*(const S lhs, const Vec<R, N>& rhs)
+{
+    return rhs * lhs;
+}
+
+template <CompoundUnitConcept L, std::size_t N, number_helper::SignedNumberConcept S>
+constexpr auto operator/(const Vec<L, N>& lhs, const S rhs)
+{
+    return vec_helper::map(lhs, [rhs](const L& l) { return l / rhs; });
+}
+///@}
+
+/**
+ * Operator* and operator/ of a vector and a compound unit.
+ * @details The element type changes by the unit algebra, e.g.
+ *          Vec<MeterPerSecond, 3> * Second => Vec<Meter, 3>.
+ * @pre The result must not be dimensionless.
+ */
+///@{
+template <CompoundUnitConcept L, std::size_t N, CompoundUnitConcept R>
+requires(CompoundUnitConcept<MultiplyUnit<L, R>>)
+constexpr auto operator*(const Vec<L, N>& lhs, const R& rhs)
+{
+    return vec_helper::map(lhs, [rhs](const L& l) { return l * rhs; });
+}
+
+template <CompoundUnitConcept L, CompoundUnitConcept R, std::size_t N>
+requires(CompoundUnitConcept<MultiplyUnit<L, R>>)
+constexpr auto operator*(const L& lhs, const Vec<R, N>& rhs)
+{
+    return vec_helper::map(rhs, [lhs](const R& r) { return lhs * r; });
+}
+
+template <CompoundUnitConcept L, std::size_t N, CompoundUnitConcept R>
+requires(CompoundUnitConcept<DivideUnit<L, R>>)
+constexpr auto operator/(const Vec<L, N>& lhs, const R& rhs)
+{
+    return vec_helper::map(lhs, [rhs](const L& l) { return l / rhs; });
+}
+///@}
+
+/**
+ * Dot product of two vectors.
+ * @return MultiplyUnit<L, R>, which is a number if the units cancel out.
+ */
+template <CompoundUnitConcept L, CompoundUnitConcept R, std::size_t N>
+constexpr auto dot(const Vec<L, N>& lhs, const Vec<R, N>& rhs)
+{
+    using ResultType = MultiplyUnit<L, R>;
+    ResultType ret{};
+    for (std::size_t i{0}; i < N; ++i)
+    {
+        ret = ret + lhs[i] * rhs[i];
+    }
+    return ret;
+}
+
+/// Cross product of two 3D vectors, the element type is MultiplyUnit<L, R>.
+template <CompoundUnitConcept L, CompoundUnitConcept R>
+requires(CompoundUnitConcept<MultiplyUnit<L, R>>)
+constexpr auto cross(const Vec<L, 3>& lhs, const Vec<R, 3>& rhs)
+{
+    return Vec<MultiplyUnit<L, R>, 3>{lhs[1] * rhs[2] - lhs[2] * rhs[1],
+                                      lhs[2] * rhs[0] - lhs[0] * rhs[2],
+                                      lhs[0] * rhs[1] - lhs[1] * rhs[0]};
+}
+
+/**
+ * Euclidean norm of a vector.
+ * @return the norm in the unit of the elements. The Rep is the floating compute type of CU,
+ *         or double if CU has an integer Rep.
+ */
+template <CompoundUnitConcept CU, std::size_t N>
+auto norm(const Vec<CU, N>& operand)
+{
+    using ComputeRep = number_helper::compute_rep_t<typename CU::Rep>;
+    using NormRep = std::conditional_t<std::floating_point<ComputeRep>, ComputeRep, double>;
+    using NormUnit = type_helper::make_specialization_t<
+        CompoundUnit, typename CU::Signatures::template push_front_t<NormRep>>;
+
+    NormRep sum{0};
+    for (std::size_t i{0}; i < N; ++i)
+    {
+        const auto x = static_cast<NormRep>(number_helper::widen(operand.data()[i]));
+        sum += x * x;
+    }
+    return NormUnit{std::sqrt(sum)};
+}
+
+/**
+ * Struct-of-arrays storage of vectors, i.e. one contiguous array of counts per axis.
+ * @details Kernels over a VecArray stream each axis separately, which vectorizes over the
+ *          rows instead of over the (few) axes.
+ */
+template <CompoundUnitConcept CU, std::size_t N>
+requires(N > 0)
+class VecArray
+{
+  public:
+    using Unit = CU;
+    using Rep = typename CU::Rep;
+
+    /// @brief Construct with `size` zero vectors.
+    explicit VecArray(const std::size_t size = 0)
+    {
+        for (std::vector<Rep>& component : components_)
+        {
+            component.resize(size);
+        }
+    }
+
+    /// @brief The number of vectors.
+    std::size_t size() const { return components_[0].size(); }
+
+    /// @brief Resize, new vectors are zero.
+    void resize(const std::size_t size)
+    {
+        for (std::vector<Rep>& component : components_)
+        {
+            component.resize(size);
+        }
+    }
+
+    /// @brief The counts of one axis of all vectors.
+    ///@{
+    std::span<Rep> component(const std::size_t axis) { return components_[axis]; }
+
+    std::span<const Rep> component(const std::size_t axis) const { return components_[axis]; }
+    ///@}
+
+    /// @brief Gather the vector at `row`.
+    Vec<CU, N> operator[](const std::size_t row) const
+    {
+        Vec<CU, N> ret{};
+        for (std::size_t axis{0}; axis < N; ++axis)
+        {
+            ret.data()[axis] = components_[axis][row];
+        }
+        return ret;
+    }
+
+    /// @brief Scatter a vector to `row`.
+    void set(const std::size_t row, const Vec<CU, N>& value)
+    {
+        for (std::size_t axis{0}; axis < N; ++axis)
+        {
+            components_[axis][row] = value.data()[axis];
+        }
+    }
+
+  private:
+    std::array<std::vector<Rep>, N> components_{};
+};
+
+/**
+ * Batch update out[i] += in[i] * factor, e.g. advancing positions by velocity * dt.
+ * @details The unit algebra is checked at compile time: the element type of `in` times the
+ *          factor must be castable to the element type of `out`. All period ratios are compile
+ *          time constants of the element-wise expression.
+ * @pre out.size() == in.size()
+ */
+///@{
+template <CompoundUnitConcept A, CompoundUnitConcept B, std::size_t N, CompoundUnitConcept F>
+requires(compound_unit_helper::are_compound_units_castable_v<A, MultiplyUnit<B, F>>)
+void addProduct(std::span<Vec<A, N>> out, std::span<const Vec<B, N>> in, const F factor)
+{
+    for (std::size_t i{0}; i < out.size(); ++i)
+    {
+        out[i] = out[i] + in[i] * factor;
+    }
+}
+
+template <CompoundUnitConcept A, CompoundUnitConcept B, std::size_t N, CompoundUnitConcept F>
+requires(compound_unit_helper::are_compound_units_castable_v<A, MultiplyUnit<B, F>>)
+void addProduct(VecArray<A, N>& out, const VecArray<B, N>& in, const F factor)
+{
+    for (std::size_t axis{0}; axis < N; ++axis)
+    {
+        const std::span<typename A::Rep> out_counts{out.component(axis)};
+        const std::span<const typename B::Rep> in_counts{in.component(axis)};
+        for (std::size_t i{0}; i < out_counts.size(); ++i)
+        {
+            out_counts[i] = A{A{out_counts[i]} + B{in_counts[i]} * factor}.count();
+        }
+    }
+}
+///@}
+
+} // namespace cpu
+
+#endif // SRC_INCLUDE_YPZ_STRONG_TYPE_VEC_H_
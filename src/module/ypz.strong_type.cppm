@@ -0,0 +1,68 @@
+/**
+ * C++20 module interface of the strong type library.
+ * @details The public headers are attached to the global module (extern "C++"), so a program may
+ *          both import ypz.strong_type and include the headers.
+ */
+module;
+
+// All the standard headers used by the public headers. They must be included in the global
+// module fragment, so that they are not attached to this module.
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <ostream>
+#include <ratio>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <version>
+#if defined(__cpp_lib_mdspan)
+#include <mdspan>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#endif
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+#if __has_include(<stdfloat>)
+#include <stdfloat>
+#endif
+
+export module ypz.strong_type;
+
+export extern "C++"
+{
+#include "ypz/strong_type/strong_type.h"
+}
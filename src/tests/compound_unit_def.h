@@ -39,6 +39,9 @@ using Minute = CompoundUnit<std::int64_t, UnitSignature<std::ratio<60, 1>, 1, Ti
 using Minute_double = CompoundUnit<double, UnitSignature<std::ratio<60, 1>, 1, TimeTag>>;
 using Second = CompoundUnit<std::int64_t, UnitSignature<RatioOne, 1, TimeTag>>;
 using Second_double = CompoundUnit<double, UnitSignature<RatioOne, 1, TimeTag>>;
+using MilliSecond = CompoundUnit<std::int64_t, UnitSignature<std::milli, 1, TimeTag>>;
+using MicroSecond = CompoundUnit<std::int64_t, UnitSignature<std::micro, 1, TimeTag>>;
+using NanoSecond = CompoundUnit<std::int64_t, UnitSignature<std::nano, 1, TimeTag>>;
 ///@}
 
 /// Velocity and acceleration units.
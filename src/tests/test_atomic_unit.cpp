@@ -0,0 +1,71 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_atomic_unit
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/atomic_unit.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace cpu
+{
+TEST(atomic_unit, operations)
+{
+    EXPECT_EQ(sizeof(AtomicUnit<NanoSecond>), sizeof(std::atomic<std::int64_t>));
+    EXPECT_TRUE(AtomicUnit<NanoSecond>::is_always_lock_free);
+
+    AtomicUnit<NanoSecond> latency{MicroSecond{1}};
+    EXPECT_EQ(latency.load().count(), 1000);
+
+    // Castable units are converted before the atomic operation.
+    EXPECT_EQ(latency.fetch_add(MilliSecond{2}).count(), 1000);
+    EXPECT_EQ(latency.fetch_sub(NanoSecond{500}).count(), 2'001'000);
+    EXPECT_EQ(latency.exchange(Second{1}).count(), 2'000'500);
+    EXPECT_EQ(latency.load(std::memory_order_relaxed).count(), 1'000'000'000);
+
+    latency.store(Minute{1}, std::memory_order_release);
+    EXPECT_EQ(latency.load(std::memory_order_acquire), Second{60});
+
+    NanoSecond expected{0};
+    EXPECT_FALSE(latency.compare_exchange_strong(expected, Second{0}));
+    EXPECT_EQ(expected, Minute{1});
+    EXPECT_TRUE(latency.compare_exchange_strong(expected, Second{0}));
+    EXPECT_EQ(latency.load().count(), 0);
+
+    AtomicUnit<Second_double> seconds{};
+    seconds.fetch_add(MilliSecond{1500});
+    EXPECT_DOUBLE_EQ(seconds.load().count(), 1.5);
+}
+
+TEST(atomic_unit, concurrent_accumulation)
+{
+    constexpr int kThreads{4};
+    constexpr int kIterations{10'000};
+
+    AtomicUnit<MicroSecond> total{};
+    std::vector<MicroSecond> per_slot(2, MicroSecond{0});
+    {
+        std::vector<std::jthread> threads{};
+        for (int t{0}; t < kThreads; ++t)
+        {
+            threads.emplace_back([&total, &per_slot, t] {
+                for (int i{0}; i < kIterations; ++i)
+                {
+                    total.fetch_add(MilliSecond{1}, std::memory_order_relaxed);
+                    AtomicUnitRef<MicroSecond>{per_slot[t % 2]}.fetch_add(
+                        NanoSecond{2000}, std::memory_order_relaxed);
+
+                    MicroSecond expected{total.load()};
+                    while (!total.compare_exchange_weak(expected, expected + MicroSecond{1}))
+                    {}
+                }
+            });
+        }
+    }
+    EXPECT_EQ(total.load().count(), kThreads * kIterations * 1001);
+    EXPECT_EQ(per_slot[0].count(), kThreads / 2 * kIterations * 2);
+    EXPECT_EQ(per_slot[1].count(), kThreads / 2 * kIterations * 2);
+}
+} // namespace cpu
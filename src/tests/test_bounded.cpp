@@ -0,0 +1,85 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_bounded
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/bounded.h"
+#include "ypz/strong_type/storage_rep.h"
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace cpu
+{
+template <std::int64_t Lo, std::int64_t Hi>
+using B = Bounded<std::int64_t, Lo, Hi>;
+
+TEST(bounded, narrowest_storage)
+{
+    EXPECT_TRUE((std::same_as<B<0, 100>::storage_type, std::uint8_t>));
+    EXPECT_TRUE((std::same_as<B<0, 1000>::storage_type, std::uint16_t>));
+    EXPECT_TRUE((std::same_as<B<-100, 100>::storage_type, std::int8_t>));
+    EXPECT_TRUE((std::same_as<B<-1000, 1000>::storage_type, std::int16_t>));
+    EXPECT_TRUE((std::same_as<B<-1, 100'000>::storage_type, std::int32_t>));
+    EXPECT_EQ(sizeof(StorageUnit<Meter, B<0, 100>>), 1);
+
+    // A value from outside of the analysis is clamped.
+    EXPECT_EQ((B<0, 100>{500}.value()), 100);
+    EXPECT_EQ((B<0, 100>{-5}.value()), 0);
+    EXPECT_EQ((B<10, 100>{}.value()), 10);
+    EXPECT_EQ((StorageUnit<Meter, B<0, 100>>{Km{1}}.count().value()), 100);
+    EXPECT_EQ((StorageUnit<Meter, B<0, 100>>{CentiMeter{4200}}.count().value()), 42);
+}
+
+TEST(bounded, range_propagation)
+{
+    using Length = StorageUnit<Meter, B<0, 100>>;
+    using Offset = StorageUnit<Meter, B<-10, 10>>;
+    constexpr Length length{B<0, 100>{50}};
+    constexpr Offset offset{B<-10, 10>{-4}};
+
+    { // The range of a product is the product of the ranges.
+        constexpr auto area = length * offset;
+        using ReturnType = std::remove_cv_t<decltype(area)>;
+        EXPECT_TRUE((std::same_as<ReturnType::Rep, B<-1000, 1000>>));
+        EXPECT_TRUE((compound_unit_helper::are_compound_units_castable_v<ReturnType, SquareMeter>));
+        EXPECT_EQ(sizeof(area), 2);
+        EXPECT_EQ(area, SquareMeter{-200});
+    }
+
+    { // The scaling of the periods is part of the range.
+        using Short = StorageUnit<CentiMeter, B<0, 100>>;
+        constexpr auto area = length * Short{B<0, 100>{40}};
+        using ReturnType = std::remove_cv_t<decltype(area)>;
+        EXPECT_TRUE((std::same_as<ReturnType::Rep, B<0, 1'000'000>>));
+        EXPECT_TRUE((std::same_as<ReturnType::Rep::storage_type, std::uint32_t>));
+        EXPECT_EQ(area, SquareMeter{20});
+    }
+
+    { // Sums are in the common unit.
+        using Distance = StorageUnit<Km, B<0, 2>>;
+        constexpr auto sum = Distance{B<0, 2>{2}} + length;
+        using ReturnType = std::remove_cv_t<decltype(sum)>;
+        EXPECT_TRUE((std::same_as<ReturnType::Rep, B<0, 2100>>));
+        EXPECT_TRUE((std::same_as<ReturnType::Rep::storage_type, std::uint16_t>));
+        EXPECT_EQ(sum, Meter{2050});
+    }
+
+    {
+        constexpr auto diff = length - offset;
+        EXPECT_TRUE((std::same_as<std::remove_cv_t<decltype(diff)>::Rep, B<-10, 110>>));
+        EXPECT_EQ(diff, Meter{54});
+
+        constexpr auto neg = -offset;
+        EXPECT_TRUE((std::same_as<std::remove_cv_t<decltype(neg)>::Rep, B<-10, 10>>));
+        EXPECT_EQ(neg, Meter{4});
+    }
+
+    { // Mixed with another rep, the computation is in the rep of the bounds.
+        constexpr auto sum = length + Meter{1000};
+        EXPECT_TRUE((std::same_as<std::remove_cv_t<decltype(sum)>::Rep, std::int64_t>));
+        EXPECT_EQ(sum, Meter{1050});
+    }
+}
+} // namespace cpu
@@ -0,0 +1,72 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_calibrated_unit
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/calibrated_unit.h"
+#include <array>
+#include <cstdint>
+#include <ratio>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace cpu
+{
+namespace
+{
+using NanoSecond_double = CompoundUnit<double, UnitSignature<std::nano, 1, TimeTag>>;
+using MicroSecond_double = CompoundUnit<double, UnitSignature<std::micro, 1, TimeTag>>;
+using Kg_double = CompoundUnit<double, UnitSignature<RatioOne, 1, MassTag>>;
+
+RuntimePeriod tsc_period{};
+using Ticks = CalibratedUnit<std::uint64_t, NanoSecond_double, &tsc_period>;
+
+using Grams = CalibratedUnit<double, Kg_double>;
+} // namespace
+
+TEST(calibrated_unit, global_period)
+{
+    // 2.5 GHz, i.e. a tick is 0.4 ns.
+    tsc_period.calibrate(0.4);
+    static_assert(sizeof(Ticks) == sizeof(std::uint64_t));
+    static_assert(!std::is_convertible_v<Ticks, NanoSecond_double>);
+    // The dimension is checked at compile time.
+    static_assert(!std::is_constructible_v<Meter_double, Ticks>);
+
+    const Ticks ticks{2'500'000'000};
+    EXPECT_DOUBLE_EQ(ticks.as<Second_double>().count(), 1.0);
+    EXPECT_DOUBLE_EQ(NanoSecond_double{ticks}.count(), 1e9);
+    EXPECT_EQ(ticks.as<MilliSecond>().count(), 1000);
+    EXPECT_DOUBLE_EQ(ticks.factorTo<MicroSecond_double>(), 0.4e-3);
+
+    EXPECT_EQ(Ticks::from(MicroSecond{2}).count(), 5000);
+    EXPECT_EQ((ticks - Ticks{500'000'000}).count(), 2'000'000'000);
+    EXPECT_TRUE(Ticks{2} < Ticks{3});
+
+    const std::array<Ticks, 3> samples{Ticks{0}, Ticks{25}, Ticks{50}};
+    std::vector<NanoSecond_double> durations(samples.size(), NanoSecond_double{});
+    calibratedCast(std::span<const Ticks>{samples}, std::span{durations});
+    EXPECT_DOUBLE_EQ(durations[1].count(), 10.0);
+    EXPECT_DOUBLE_EQ(durations[2].count(), 20.0);
+
+    // Recalibrate.
+    tsc_period.calibrate(1.0);
+    EXPECT_DOUBLE_EQ(ticks.as<Second_double>().count(), 2.5);
+}
+
+TEST(calibrated_unit, instance_period)
+{
+    // Per-device calibration, one count is 1.5 g of device a and 0.5 g of device b.
+    const RuntimePeriod device_a{1.5e-3};
+    const RuntimePeriod device_b{0.5e-3};
+    const Grams a{10.0, device_a};
+    const Grams b{10.0, device_b};
+    EXPECT_DOUBLE_EQ(a.as<Kg_double>().count(), 0.015);
+    EXPECT_DOUBLE_EQ(b.as<Kg_double>().count(), 0.005);
+    EXPECT_DOUBLE_EQ(Grams::from(Kg_double{0.003}, device_b).count(), 6.0);
+    EXPECT_EQ(&a.period(), &device_a);
+}
+
+} // namespace cpu
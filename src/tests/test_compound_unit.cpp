@@ -7,6 +7,8 @@ bazelisk run --config=cpp20 //src/tests:test_compound_unit
 #include "ypz/strong_type/compound_unit.h"
 #include "ypz/strong_type/signature.h"
 #include <cmath>
+#include <concepts>
+#include <cstdint>
 #include <ratio>
 
 namespace cpu
@@ -35,6 +37,17 @@ TEST(constructor, _)
         constexpr KmPerHour v = MeterPerSecond_double{10.0};
         EXPECT_EQ(v.count(), 36);
     }
+
+    { // Construct uninitialized, usable in constant evaluation if written before read.
+        constexpr KmPerHour v{[] {
+            KmPerHour ret{uninit};
+            ret = KmPerHour{7};
+            return ret;
+        }()};
+        EXPECT_EQ(v.count(), 7);
+        EXPECT_TRUE((std::is_trivially_copyable_v<KmPerHour>));
+        EXPECT_FALSE((std::is_convertible_v<uninit_t, KmPerHour>));
+    }
 }
 
 TEST(special_member_functions, _)
@@ -273,4 +286,23 @@ TEST(operator_plus_minus, _)
             (compound_unit_helper::are_compound_unit_equal_v<ReturnType, SquareMillimeter>));
     }
 }
+
+TEST(unit_algebra, _)
+{
+    // The type level algebra yields the types of the operators.
+    static_assert(std::same_as<multiply_unit_t<Km, Meter>, decltype(Km{} * Meter{})>);
+    static_assert(std::same_as<divide_unit_t<Km, Hour>, decltype(Km{} / Hour{1})>);
+    static_assert(std::same_as<divide_unit_t<Km, Meter>, std::int64_t>);
+    static_assert(std::same_as<multiply_unit_t<Newton, inverse_unit_t<Kg>>, MeterPerSecondSquare>);
+    static_assert(std::same_as<divide_unit_t<Meter_double, Second>, MeterPerSecond_double>);
+
+    static_assert(std::same_as<inverse_unit_t<inverse_unit_t<KmPerHour>>, KmPerHour>);
+    static_assert(std::same_as<pow_unit_t<Meter, 2>, SquareMeter>);
+    static_assert(std::same_as<pow_unit_t<Meter, 1>, Meter>);
+    static_assert(std::same_as<pow_unit_t<MeterPerSecond, -2>,
+                               inverse_unit_t<multiply_unit_t<MeterPerSecond, MeterPerSecond>>>);
+
+    using CubicMeter_double = pow_unit_t<Meter_double, 3>;
+    EXPECT_DOUBLE_EQ((CubicMeter_double{8.0} / SquareMeter_double{4.0}).count(), 2.0);
+}
 } // namespace cpu
@@ -0,0 +1,77 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_constant
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/constant.h"
+#include <compare>
+#include <concepts>
+#include <type_traits>
+
+namespace cpu
+{
+/// Kernel specialized on a compile time threshold.
+template <Constant Threshold, CompoundUnitConcept CU>
+constexpr bool exceeds(const CU& value)
+{
+    return value > Threshold;
+}
+
+TEST(constant, structural_compound_unit)
+{
+    using Five = Constant<Meter{5}>;
+    EXPECT_TRUE((std::same_as<Five::Unit, Meter>));
+    EXPECT_EQ(Five::value, Meter{5});
+    EXPECT_EQ(Five::as<CentiMeter>.count(), 500);
+    EXPECT_TRUE((std::same_as<decltype(constant<Meter{5}>), const Five>));
+    EXPECT_TRUE((ConstantConcept<Five>));
+    EXPECT_FALSE((ConstantConcept<Meter>));
+
+    constexpr Meter converted{constant<Km_double{0.5}>};
+    EXPECT_EQ(converted, Meter{500});
+}
+
+TEST(constant, fold_constants)
+{
+    { // The operators of two constants return a constant.
+        constexpr auto speed = constant<Meter{10}> / constant<Second{2}>;
+        EXPECT_TRUE((ConstantConcept<std::remove_cv_t<decltype(speed)>>));
+        EXPECT_EQ(decltype(speed)::value, MeterPerSecond{5});
+
+        constexpr auto sum = constant<Km{1}> + constant<Meter{5}> - constant<CentiMeter{100}>;
+        EXPECT_EQ(decltype(sum)::value, Meter{1004});
+
+        constexpr auto area = -constant<Meter{2}> * constant<Meter{3}>;
+        EXPECT_EQ(decltype(area)::value, SquareMeter{-6});
+    }
+
+    { // The operators with a runtime compound unit use the pre-scaled constant.
+        const Meter length{250};
+        EXPECT_EQ(length + constant<Km{1}>, Meter{1250});
+        EXPECT_EQ(constant<Km{1}> + length, Meter{1250});
+        EXPECT_EQ(length - constant<CentiMeter{50}>, CentiMeter{24950});
+        EXPECT_EQ(length * constant<Meter{4}>, SquareMeter{1000});
+        EXPECT_EQ(constant<CentiMeter{4}> * length, SquareMeter{10});
+        EXPECT_EQ(length / constant<Second{5}>, MeterPerSecond{50});
+        EXPECT_EQ(KmPerHour_double{36.0} * constant<Second{10}>, Meter{100});
+        // The scaling of 36 km/h * 1 s truncates in integers, which falls back to the operator.
+        EXPECT_EQ(KmPerHour{36} * constant<Second{1}>, KmPerHour{36} * Second{1});
+
+        EXPECT_TRUE(length < constant<Km{1}>);
+        EXPECT_TRUE(length == constant<CentiMeter{25000}>);
+        EXPECT_EQ(length <=> constant<Meter{100}>, std::partial_ordering::greater);
+    }
+}
+
+TEST(constant, kernels)
+{
+    EXPECT_EQ((clamp<Km{1}, Km{2}>(Meter{1500})), Meter{1500});
+    EXPECT_EQ((clamp<Km{1}, Km{2}>(Meter{500})), Meter{1000});
+    EXPECT_EQ((clamp<Km{1}, Km{2}>(Meter{5000})), Meter{2000});
+    EXPECT_EQ((clamp<Meter{0}, Meter_double{1.5}>(CentiMeter{-3})), CentiMeter{0});
+
+    EXPECT_TRUE((exceeds<constant<KmPerHour{36}>>(MeterPerSecond{11})));
+    EXPECT_FALSE((exceeds<constant<KmPerHour{36}>>(MeterPerSecond{10})));
+}
+} // namespace cpu
@@ -0,0 +1,110 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_conversion_cost
+*/
+// Only the identity conversions are implicit in this test binary.
+#define CPU_STRONG_TYPE_STRICT
+
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/dimension_unit.h"
+#include "ypz/strong_type/unit_array.h"
+#include "ypz/strong_type/vec.h"
+#include <cstdint>
+#include <type_traits>
+
+namespace cpu
+{
+TEST(conversion_cost, cost)
+{
+    static_assert(conversion_cost_v<Newton, Newton_alias> == ConversionCost::Identity);
+    static_assert(conversion_cost_v<Meter, Meter_double> == ConversionCost::RepChange);
+    static_assert(conversion_cost_v<Km, Meter> == ConversionCost::ExactMultiply);
+    static_assert(conversion_cost_v<Km, Meter_double> == ConversionCost::ExactMultiply);
+    static_assert(conversion_cost_v<Meter, Km> == ConversionCost::LossyDivide);
+    static_assert(conversion_cost_v<MeterPerSecond_double, KmPerHour> ==
+                  ConversionCost::LossyDivide);
+    static_assert(ConversionCost::Identity < ConversionCost::RepChange &&
+                  ConversionCost::RepChange < ConversionCost::ExactMultiply &&
+                  ConversionCost::ExactMultiply < ConversionCost::LossyDivide);
+}
+
+TEST(conversion_cost, strict_mode)
+{
+    static_assert(compound_unit_helper::is_strict_mode_v);
+    // Only the identity stays implicit, the costly conversions need unit_cast.
+    static_assert(std::is_convertible_v<Newton_alias, Newton>);
+    static_assert(!std::is_convertible_v<Meter, Meter_double>);
+    static_assert(!std::is_convertible_v<Km, Meter>);
+    static_assert(!std::is_convertible_v<MeterPerSecond_double, KmPerHour>);
+    static_assert(std::is_constructible_v<Meter, Km>);
+
+    const KmPerHour speed{unit_cast<KmPerHour>(MeterPerSecond_double{10.0})};
+    EXPECT_EQ(speed.count(), 36);
+    EXPECT_EQ(unit_cast<Meter>(Km{2}).count(), 2000);
+    // The operators still cast internally.
+    EXPECT_EQ((Meter{500} + Km{1}).count(), 1500);
+    EXPECT_TRUE(Meter{1001} > Km{1});
+    EXPECT_TRUE(Meter{1000} == Km{1});
+    EXPECT_TRUE(Meter{1000} != Meter_double{1.0});
+    EXPECT_TRUE(Meter_double{1000.0} == Meter{1000});
+}
+
+TEST(conversion_cost, strict_narrow_rep)
+{
+    // The arithmetic on a built-in rep keeps it, so no implicit rep change is needed.
+    using Meter16 = CompoundUnit<std::int16_t, UnitSignature<RatioOne, 1, LengthTag>>;
+    constexpr Meter16 a{300};
+    constexpr Meter16 b{-100};
+    constexpr Meter16 sum = a + b;
+    constexpr Meter16 difference = a - b;
+    constexpr Meter16 negation = -a;
+    EXPECT_EQ(sum.count(), 200);
+    EXPECT_EQ(difference.count(), 400);
+    EXPECT_EQ(negation.count(), -300);
+}
+
+TEST(conversion_cost, strict_dimension_unit)
+{
+    using Mechanics = DimensionSystem<LengthTag, MassTag, TimeTag>;
+    using DKm = to_dimension_unit_t<Mechanics, Km>;
+    using DMeter = to_dimension_unit_t<Mechanics, Meter>;
+
+    // The conversions of DimensionUnit follow the costs of the equivalent compound units.
+    static_assert(std::is_convertible_v<DMeter, Meter> && std::is_convertible_v<Meter, DMeter>);
+    static_assert(!std::is_convertible_v<DMeter, Km>);
+    static_assert(!std::is_convertible_v<DMeter, DKm>);
+    static_assert(!std::is_convertible_v<Km, DMeter>);
+    static_assert(!std::is_convertible_v<DMeter, Meter_double>);
+
+    EXPECT_EQ(Km{DMeter{1500}}.count(), 1);
+    EXPECT_EQ(DKm{DMeter{2500}}.count(), 2);
+    EXPECT_EQ(DMeter{Km{2}}.count(), 2000);
+}
+
+TEST(conversion_cost, strict_batch_types)
+{
+    // The batch types of the hot loops follow the costs of their elements.
+    const UnitArray<Meter> meters(2, Meter{1500});
+    using MeterExpr = decltype(meters + meters);
+    static_assert(std::is_convertible_v<MeterExpr, UnitArray<Meter>>);
+    static_assert(std::is_assignable_v<UnitArray<Meter>&, MeterExpr>);
+    static_assert(!std::is_convertible_v<MeterExpr, UnitArray<Km>>);
+    static_assert(!std::is_assignable_v<UnitArray<Km>&, MeterExpr>);
+    static_assert(!std::is_convertible_v<MeterExpr, UnitArray<Meter_double>>);
+    static_assert(!std::is_assignable_v<UnitArray<Km>&, const UnitArray<Meter>&>);
+    static_assert(!std::is_convertible_v<Vec<Meter, 3>, Vec<Km, 3>>);
+    static_assert(!std::is_convertible_v<Vec<Km, 3>, Vec<Meter, 3>>);
+    static_assert(std::is_constructible_v<Vec<Km, 3>, Vec<Meter, 3>>);
+
+    UnitArray<Km> km{meters + meters};
+    EXPECT_EQ(km[0].count(), 3);
+    km = UnitArray<Km>{meters};
+    EXPECT_EQ(km[1].count(), 1);
+
+    const Vec<Km, 3> vk{Vec<Meter, 3>{Meter{1500}, Meter{2500}, Meter{0}}};
+    EXPECT_EQ(vk[1].count(), 2);
+}
+
+} // namespace cpu
@@ -0,0 +1,127 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_csv_reader
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/csv_reader.h"
+#include <array>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cpu
+{
+namespace
+{
+const std::array<FormulaInput, 5> kSymbols{
+    FormulaInput{"km", DynamicUnit::of<Km>()}, FormulaInput{"m", DynamicUnit::of<Meter>()},
+    FormulaInput{"mm", DynamicUnit::of<MilliMeter>()}, FormulaInput{"h", DynamicUnit::of<Hour>()},
+    FormulaInput{"s", DynamicUnit::of<Second>()}};
+} // namespace
+
+TEST(csv_reader, header_cell)
+{
+    const auto cell = csv_helper::parseHeaderCell(" speed [km/h] ");
+    ASSERT_TRUE(cell.has_value());
+    EXPECT_EQ(cell->name, "speed");
+    EXPECT_EQ(cell->unit, "km/h");
+    EXPECT_FALSE(csv_helper::parseHeaderCell("speed[km/h").has_value());
+
+    const auto unit = csv_helper::resolveUnit("km/h", kSymbols);
+    ASSERT_TRUE(unit.has_value());
+    EXPECT_TRUE(unit->hasSameDimension(DynamicUnit::of<KmPerHour>()));
+    EXPECT_DOUBLE_EQ(unit->scale(), 1000.0 / 3600.0);
+    EXPECT_FALSE(csv_helper::resolveUnit("1000*m", kSymbols).has_value());
+    EXPECT_FALSE(csv_helper::resolveUnit("km+m", kSymbols).has_value());
+    EXPECT_FALSE(csv_helper::resolveUnit("furlong", kSymbols).has_value());
+}
+
+TEST(csv_reader, read_columns)
+{
+    const std::string_view text{"time[h],label,speed[km/h],distance[mm]\r\n"
+                                "0.5,a,36,1500\r\n"
+                                "\r\n"
+                                "1, b , 72 ,+2500\r\n"};
+    UnitArray<Second_double> time{};
+    UnitArray<MeterPerSecond_double> speed{};
+    UnitArray<Meter> distance{};
+    const auto rows = readCsv(text, kSymbols, 1, csvColumn("speed", speed),
+                              csvColumn("time", time), csvColumn("distance", distance));
+    ASSERT_EQ(rows, 2);
+    ASSERT_EQ(time.size(), 2);
+    EXPECT_DOUBLE_EQ(time[0].count(), 1800.0);
+    EXPECT_DOUBLE_EQ(time[1].count(), 3600.0);
+    EXPECT_DOUBLE_EQ(speed[0].count(), 10.0);
+    EXPECT_DOUBLE_EQ(speed[1].count(), 20.0);
+    // Rounded to the nearest integer.
+    EXPECT_EQ(distance[0].count(), 2);
+    EXPECT_EQ(distance[1].count(), 3);
+}
+
+TEST(csv_reader, integral_rounding)
+{
+    const std::string_view text{"length[m]\n4.35\n-4.35\n0.004\n"};
+    UnitArray<CentiMeter> length{};
+    ASSERT_EQ(readCsv(text, kSymbols, 1, csvColumn("length", length)), 3);
+    EXPECT_EQ(length[0].count(), 435);
+    EXPECT_EQ(length[1].count(), -435);
+    EXPECT_EQ(length[2].count(), 0);
+}
+
+TEST(csv_reader, errors)
+{
+    UnitArray<MeterPerSecond_double> speed{};
+    // Missing column, wrong dimension, unknown symbol and malformed number.
+    EXPECT_FALSE(readCsv("velocity[km/h]\n1\n", kSymbols, 1, csvColumn("speed", speed)));
+    EXPECT_FALSE(readCsv("speed[km]\n1\n", kSymbols, 1, csvColumn("speed", speed)));
+    EXPECT_FALSE(readCsv("speed[mi/h]\n1\n", kSymbols, 1, csvColumn("speed", speed)));
+    EXPECT_FALSE(readCsv("speed[km/h]\n1x\n", kSymbols, 1, csvColumn("speed", speed)));
+    EXPECT_EQ(readCsv("speed[km/h]\n", kSymbols, 1, csvColumn("speed", speed)), 0);
+}
+
+TEST(csv_reader, parallel_chunks)
+{
+    std::string text{"distance[m],duration[s]\n"};
+    constexpr std::size_t kRows{300'000};
+    for (std::size_t i{0}; i < kRows; ++i)
+    {
+        text += std::to_string(i) + ",1\n";
+    }
+    const std::vector<std::string_view> chunks{csv_helper::splitChunks(text, 4)};
+    ASSERT_EQ(chunks.size(), 4);
+    for (const std::string_view chunk : chunks)
+    {
+        EXPECT_EQ(chunk.back(), '\n');
+    }
+
+    UnitArray<Km_double> distance{};
+    UnitArray<Second> duration{};
+    const auto rows = readCsv(text, kSymbols, 4, csvColumn("distance", distance),
+                              csvColumn("duration", duration));
+    ASSERT_EQ(rows, kRows);
+    for (std::size_t i{0}; i < kRows; ++i)
+    {
+        ASSERT_DOUBLE_EQ(distance[i].count(), static_cast<double>(i) / 1000.0);
+        ASSERT_EQ(duration[i].count(), 1);
+    }
+}
+
+TEST(csv_reader, mapped_file)
+{
+    const std::string path{testing::TempDir() + "csv_reader_test.csv"};
+    std::ofstream{path} << "length[km]\n1.5\n2";
+
+    const std::optional<MappedFile> file{MappedFile::open(path)};
+    ASSERT_TRUE(file.has_value());
+    UnitArray<Meter_double> length{};
+    EXPECT_EQ(readCsv(file->text(), kSymbols, 0, csvColumn("length", length)), 2);
+    EXPECT_DOUBLE_EQ(length[0].count(), 1500.0);
+    EXPECT_DOUBLE_EQ(length[1].count(), 2000.0);
+
+    EXPECT_FALSE(MappedFile::open(path + ".missing").has_value());
+}
+
+} // namespace cpu
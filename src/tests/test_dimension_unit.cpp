@@ -0,0 +1,86 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_dimension_unit
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/dimension_unit.h"
+#include <type_traits>
+
+namespace cpu
+{
+namespace
+{
+using Mechanics = DimensionSystem<LengthTag, MassTag, TimeTag>;
+
+using DKm = to_dimension_unit_t<Mechanics, Km>;
+using DMeter = to_dimension_unit_t<Mechanics, Meter>;
+using DHour = to_dimension_unit_t<Mechanics, Hour>;
+using DSecond = to_dimension_unit_t<Mechanics, Second>;
+using DKmPerHour = to_dimension_unit_t<Mechanics, KmPerHour>;
+using DMeterPerSecond_double = to_dimension_unit_t<Mechanics, MeterPerSecond_double>;
+using DKg = to_dimension_unit_t<Mechanics, Kg>;
+} // namespace
+
+TEST(dimension_unit, representation)
+{
+    static_assert(DKmPerHour::Dim.exp == std::array<std::int32_t, 3>{1, 0, -1});
+    static_assert(std::ratio_equal_v<DKmPerHour::Period, KmPerHour::Period>);
+    static_assert(DimensionUnitConcept<DKm>);
+    static_assert(!DimensionUnitConcept<Km>);
+    static_assert(std::is_same_v<to_compound_unit_t<DKmPerHour>, KmPerHour>);
+    static_assert(
+        std::is_same_v<to_compound_unit_t<DMeterPerSecond_double>, MeterPerSecond_double>);
+}
+
+TEST(dimension_unit, algebra)
+{
+    // The same types and counts as the tag based algebra.
+    const auto speed = DKm{36} / DHour{2};
+    static_assert(std::is_same_v<std::remove_const_t<decltype(speed)>, DKmPerHour>);
+    EXPECT_EQ(speed.count(), (Km{36} / Hour{2}).count());
+
+    const auto mixed = DKm{3} / DSecond{2};
+    static_assert(
+        std::is_same_v<to_compound_unit_t<std::remove_const_t<decltype(mixed)>>,
+                       decltype(Km{3} / Second{2})>);
+    EXPECT_EQ(mixed.count(), (Km{3} / Second{2}).count());
+
+    const auto area = DKm{2} * DMeter{3};
+    static_assert(std::is_same_v<to_compound_unit_t<std::remove_const_t<decltype(area)>>,
+                                 decltype(Km{2} * Meter{3})>);
+    EXPECT_EQ(area.count(), (Km{2} * Meter{3}).count());
+
+    // Dimensionless.
+    const auto ratio = DKm{3} / DMeter{1500};
+    static_assert(std::is_same_v<std::remove_const_t<decltype(ratio)>, std::int64_t>);
+    EXPECT_EQ(ratio, 2);
+
+    const auto momentum = DKg{2} * speed * 2;
+    EXPECT_EQ(momentum.count(), 72);
+    EXPECT_EQ((momentum / 4).count(), 18);
+    EXPECT_EQ((-speed).count(), -18);
+}
+
+TEST(dimension_unit, conversion_and_comparison)
+{
+    const DMeter meters{DKm{2}};
+    EXPECT_EQ(meters.count(), 2000);
+    EXPECT_EQ((DKm{1} + DMeter{500}).count(), 1500);
+    EXPECT_EQ((DKm{1} - DMeter{500}).count(), 500);
+    EXPECT_TRUE(DKm{1} > DMeter{999});
+    EXPECT_TRUE(DKm{1} == DMeter{1000});
+    EXPECT_TRUE(DKm{1} < DKm{2});
+
+    // Interoperability with the tag based compound units.
+    const DMeterPerSecond_double speed{KmPerHour{36}};
+    EXPECT_DOUBLE_EQ(speed.count(), 10.0);
+    const KmPerHour back{speed};
+    EXPECT_EQ(back.count(), 36);
+    const Meter m = DKm{3};
+    EXPECT_EQ(m.count(), 3000);
+    static_assert(!std::is_constructible_v<DMeter, Second>);
+    static_assert(!std::is_constructible_v<Second, DMeter>);
+}
+
+} // namespace cpu
@@ -0,0 +1,113 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_formula
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/formula.h"
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace cpu
+{
+using formula_helper::OpCode;
+
+TEST(dynamic_unit, dimension)
+{
+    const DynamicUnit km_per_hour{DynamicUnit::of<KmPerHour>()};
+    EXPECT_DOUBLE_EQ(km_per_hour.scale(), 1000.0 / 3600.0);
+    EXPECT_TRUE(km_per_hour.hasSameDimension(DynamicUnit::of<MeterPerSecond_double>()));
+    EXPECT_FALSE(km_per_hour.hasSameDimension(DynamicUnit::of<Meter>()));
+
+    const DynamicUnit speed{DynamicUnit::of<Km>() / DynamicUnit::of<Hour>()};
+    EXPECT_TRUE(speed.hasSameDimension(km_per_hour));
+    EXPECT_DOUBLE_EQ(speed.scale(), km_per_hour.scale());
+    EXPECT_TRUE((speed / km_per_hour).isDimensionless());
+    EXPECT_TRUE((DynamicUnit::of<Newton>().hasSameDimension(DynamicUnit::of<Newton_alias>())));
+}
+
+TEST(formula, fold_scaling)
+{
+    const std::array<FormulaInput, 2> inputs{FormulaInput{"distance", DynamicUnit::of<Km>()},
+                                             FormulaInput{"duration", DynamicUnit::of<Minute>()}};
+    const std::optional<Formula> speed{
+        Formula::compile("distance / duration", inputs, DynamicUnit::of<MeterPerSecond>())};
+    ASSERT_TRUE(speed.has_value());
+
+    // The scaling of the inputs and the output is folded into a single constant.
+    const std::span<const formula_helper::Instruction> code{speed->bytecode()};
+    ASSERT_EQ(code.size(), 4);
+    EXPECT_EQ(code[0].op, OpCode::Load);
+    EXPECT_DOUBLE_EQ(code[0].constant, 1.0);
+    EXPECT_EQ(code[1].op, OpCode::Load);
+    EXPECT_EQ(code[2].op, OpCode::Divide);
+    EXPECT_EQ(code[3].op, OpCode::Scale);
+    EXPECT_DOUBLE_EQ(code[3].constant, 1000.0 / 60.0);
+
+    std::vector<double> distance(1000);
+    std::vector<double> duration(1000);
+    for (std::size_t i{0}; i < distance.size(); ++i)
+    {
+        distance[i] = static_cast<double>(i);
+        duration[i] = 2.0;
+    }
+    const std::array<std::span<const double>, 2> columns{distance, duration};
+    std::vector<double> out(distance.size());
+    speed->evaluate(columns, out);
+    for (std::size_t i{0}; i < out.size(); ++i)
+    {
+        ASSERT_DOUBLE_EQ(out[i], static_cast<double>(i) * 1000.0 / 120.0);
+    }
+}
+
+TEST(formula, arithmetic)
+{
+    const std::array<FormulaInput, 3> inputs{FormulaInput{"a", DynamicUnit::of<Meter_double>()},
+                                             FormulaInput{"b", DynamicUnit::of<CentiMeter>()},
+                                             FormulaInput{"t", DynamicUnit::of<Second>()}};
+    const std::array<double, 1> a{3.0};
+    const std::array<double, 1> b{50.0};
+    const std::array<double, 1> t{4.0};
+    const std::array<std::span<const double>, 3> columns{a, b, t};
+
+    const auto evaluate = [&](std::string_view source, const DynamicUnit& output) {
+        const std::optional<Formula> formula{Formula::compile(source, inputs, output)};
+        EXPECT_TRUE(formula.has_value()) << source;
+        std::array<double, 1> out{};
+        if (formula)
+        {
+            formula->evaluate(columns, out);
+        }
+        return out[0];
+    };
+
+    const DynamicUnit meter{DynamicUnit::of<Meter_double>()};
+    EXPECT_DOUBLE_EQ(evaluate("a + b", meter), 3.5);
+    EXPECT_DOUBLE_EQ(evaluate("b - a", meter), -2.5);
+    EXPECT_DOUBLE_EQ(evaluate("-(a - b) * 2", meter), -5.0);
+    EXPECT_DOUBLE_EQ(evaluate("2 * 3 * a", meter), 18.0);
+    EXPECT_DOUBLE_EQ(evaluate("(1.5 - 0.5) * 2 * b", meter), 1.0);
+    EXPECT_DOUBLE_EQ(evaluate("a / (a / b) + b", DynamicUnit::of<CentiMeter>()), 100.0);
+    EXPECT_DOUBLE_EQ(evaluate("(a + b) / t * 3.6", DynamicUnit::of<MeterPerSecond>()), 3.15);
+    EXPECT_DOUBLE_EQ(evaluate("12 / t", DynamicUnit{} / DynamicUnit::of<Second>()), 3.0);
+    EXPECT_DOUBLE_EQ(evaluate("a * a / (a * 2)", meter), 1.5);
+    EXPECT_DOUBLE_EQ(evaluate(" 4 ", DynamicUnit{}), 4.0);
+}
+
+TEST(formula, errors)
+{
+    const std::array<FormulaInput, 2> inputs{FormulaInput{"a", DynamicUnit::of<Meter>()},
+                                             FormulaInput{"t", DynamicUnit::of<Second>()}};
+    const DynamicUnit meter{DynamicUnit::of<Meter>()};
+    EXPECT_FALSE(Formula::compile("a + t", inputs, meter));    // Sum of different dimensions.
+    EXPECT_FALSE(Formula::compile("a / t", inputs, meter));    // Dimension of the output.
+    EXPECT_FALSE(Formula::compile("a + 1", inputs, meter));    // Sum with a dimensionless.
+    EXPECT_FALSE(Formula::compile("a * b", inputs, meter));    // Unknown input.
+    EXPECT_FALSE(Formula::compile("(a", inputs, meter));       // Syntax errors.
+    EXPECT_FALSE(Formula::compile("a a", inputs, meter));
+    EXPECT_FALSE(Formula::compile("", inputs, meter));
+    EXPECT_TRUE(Formula::compile("a * t / t", inputs, meter));
+}
+} // namespace cpu
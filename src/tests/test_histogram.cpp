@@ -0,0 +1,72 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_histogram
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/histogram.h"
+#include <cstdint>
+#include <memory>
+
+namespace cpu
+{
+TEST(histogram, log_linear_layout)
+{
+    using Layout = histogram_helper::LogLinearLayout<(1ULL << 20), 4>;
+    EXPECT_EQ(Layout::kBucketCount, 16 + 17 * 8);
+
+    for (std::uint64_t count{0}; count <= (1ULL << 20); ++count)
+    { // Every count lies in its bucket, and the bucket width is within the relative precision.
+        const std::size_t index{Layout::indexOf(count)};
+        ASSERT_LT(index, Layout::kBucketCount);
+        ASSERT_LE(Layout::lowestOf(index), count);
+        ASSERT_GE(Layout::highestOf(index), count);
+        ASSERT_LE((Layout::highestOf(index) - Layout::lowestOf(index)) * 8,
+                  std::max<std::uint64_t>(Layout::lowestOf(index), 1));
+    }
+}
+
+TEST(histogram, record_and_percentile)
+{
+    auto latency = std::make_unique<Histogram<MicroSecond>>();
+    EXPECT_EQ(latency->percentile(50), MicroSecond{0});
+
+    for (std::int64_t i{1}; i <= 1000; ++i)
+    {
+        latency->record(MicroSecond{i});
+    }
+    // Any castable unit is converted to MicroSecond before bucketing.
+    latency->record(MilliSecond{5});
+    latency->record(NanoSecond{10'000'000}, 2);
+    latency->record(Second_double{-1.0}); // Recorded as zero.
+
+    EXPECT_EQ(latency->total_count(), 1004);
+    EXPECT_EQ(latency->min(), MicroSecond{0});
+    EXPECT_EQ(latency->max(), MilliSecond{10});
+    EXPECT_EQ(latency->count_at(MilliSecond{10}), 2);
+
+    EXPECT_EQ(latency->percentile(0), MicroSecond{0});
+    EXPECT_EQ(latency->percentile(100), MilliSecond{10});
+    EXPECT_NEAR(static_cast<double>(latency->percentile(50).count()), 502.0, 502.0 / 64);
+    EXPECT_NEAR(static_cast<double>(latency->percentile(99).count()), 994.0, 994.0 / 64);
+}
+
+TEST(histogram, merge)
+{
+    auto thread_0 = std::make_unique<Histogram<NanoSecond>>();
+    auto thread_1 = std::make_unique<Histogram<NanoSecond>>();
+    thread_0->record(MicroSecond{1});
+    thread_1->record(MicroSecond{3});
+    thread_1->record(MicroSecond{2});
+
+    auto snapshot = std::make_unique<Histogram<NanoSecond>>(*thread_0);
+    snapshot->merge(*thread_1);
+    EXPECT_EQ(snapshot->total_count(), 3);
+    EXPECT_EQ(snapshot->min(), MicroSecond{1});
+    EXPECT_EQ(snapshot->max(), MicroSecond{3});
+    EXPECT_NEAR(static_cast<double>(snapshot->percentile(50).count()), 2000.0, 2000.0 / 64);
+
+    snapshot->reset();
+    EXPECT_EQ(snapshot->total_count(), 0);
+}
+} // namespace cpu
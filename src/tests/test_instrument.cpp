@@ -0,0 +1,103 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_instrument
+*/
+// Instrument every compound unit of this test binary.
+#define CPU_STRONG_TYPE_INSTRUMENT
+
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/dimension_unit.h"
+#include "ypz/strong_type/instrument.h"
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cpu
+{
+TEST(instrument, count_hidden_conversions)
+{
+    resetConversionCounts();
+
+    const Meter m{1500};
+    const Km km{1};
+    for (int i{0}; i < 3; ++i)
+    {
+        // The comparison and the sum cast km to m.
+        EXPECT_TRUE(m > km);
+        EXPECT_EQ((m + km).count(), 2500);
+    }
+    // Same period and rep, nothing to count.
+    EXPECT_EQ((m + m).count(), 3000);
+    // A rep change.
+    const Meter_double meter_double{m};
+    EXPECT_DOUBLE_EQ(meter_double.count(), 1500.0);
+    // Constant evaluation is not counted.
+    static_assert(Meter{Km{2}}.count() == 2000);
+
+    const std::vector<ConversionCount> report{conversionReport()};
+    ASSERT_EQ(report.size(), 2);
+    EXPECT_EQ(report[0].count, 6);
+    EXPECT_NE(report[0].from.find("std::ratio<1000"), std::string_view::npos);
+    EXPECT_EQ(report[0].to, report[1].from);
+    EXPECT_EQ(report[1].count, 1);
+    EXPECT_EQ(conversionReport(1).size(), 1);
+
+    std::ostringstream os{};
+    writeConversionReport(os, 1);
+    EXPECT_EQ(os.str().substr(0, 3), "6: ");
+
+    resetConversionCounts();
+    EXPECT_TRUE(conversionReport().empty());
+}
+
+TEST(instrument, dimension_unit)
+{
+    using Mechanics = DimensionSystem<LengthTag, MassTag, TimeTag>;
+    using DKm = to_dimension_unit_t<Mechanics, Km>;
+    using DMeter = to_dimension_unit_t<Mechanics, Meter>;
+    resetConversionCounts();
+
+    // The conversions of DimensionUnit are counted like the ones of the compound units.
+    const DKm km{2};
+    const DMeter meter{km};
+    EXPECT_EQ(meter.count(), 2000);
+    EXPECT_EQ(Meter{km}.count(), 2000);
+    EXPECT_EQ(DMeter{Km{3}}.count(), 3000);
+    const DMeter same{Meter{4}};
+    EXPECT_EQ(same.count(), 4);
+
+    const std::vector<ConversionCount> report{conversionReport()};
+    ASSERT_EQ(report.size(), 1);
+    EXPECT_EQ(report[0].count, 3);
+    resetConversionCounts();
+}
+
+TEST(instrument, merge_threads)
+{
+    resetConversionCounts();
+    std::vector<std::thread> threads{};
+    for (int t{0}; t < 4; ++t)
+    {
+        threads.emplace_back([] {
+            for (int i{0}; i < 100; ++i)
+            {
+                const CentiMeter cm{Meter{i}};
+                EXPECT_EQ(cm.count(), i * 100);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    const CentiMeter cm{Meter{1}};
+    EXPECT_EQ(cm.count(), 100);
+
+    const std::vector<ConversionCount> report{conversionReport()};
+    ASSERT_EQ(report.size(), 1);
+    EXPECT_EQ(report[0].count, 401);
+}
+
+} // namespace cpu
@@ -0,0 +1,75 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_integrate
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/integrate.h"
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace cpu
+{
+namespace
+{
+using MeterPerSecondSquare_double = DivideUnit<MeterPerSecond_double, Second_double>;
+} // namespace
+
+TEST(integrate, euler)
+{
+    // Km += km/h * ms, the factors are folded into one multiplier.
+    static_assert(integrate_helper::step_factor_v<Km_double, KmPerHour_double, MilliSecond> ==
+                  1.0 / 3'600'000.0);
+    static_assert(
+        !integrate_helper::IntegrableConcept<Km_double, MeterPerSecondSquare_double, Second>);
+    static_assert(!integrate_helper::IntegrableConcept<Meter, MeterPerSecond, Second>);
+
+    std::vector<Km_double> x{Km_double{1.0}, Km_double{2.0}};
+    const std::vector<KmPerHour_double> v{KmPerHour_double{36.0}, KmPerHour_double{-72.0}};
+    for (int i{0}; i < 1000; ++i)
+    {
+        eulerStep(std::span{x}, std::span{v}, MilliSecond{100});
+    }
+    EXPECT_NEAR(x[0].count(), 2.0, 1e-12);
+    EXPECT_NEAR(x[1].count(), 0.0, 1e-12);
+}
+
+TEST(integrate, velocity_verlet)
+{
+    // Harmonic oscillator a = -x (in s^-2), with x(0) = 1 m and v(0) = 0, i.e. x(t) = cos(t).
+    std::vector<Meter_double> x(4, Meter_double{1.0});
+    std::vector<MeterPerSecond_double> v(4, MeterPerSecond_double{0.0});
+    std::vector<MeterPerSecondSquare_double> a(4, MeterPerSecondSquare_double{-1.0});
+    const auto spring = [](const std::span<const Meter_double> pos,
+                           const std::span<MeterPerSecondSquare_double> acc) {
+        for (std::size_t i{0}; i < pos.size(); ++i)
+        {
+            acc[i] = MeterPerSecondSquare_double{-pos[i].count()};
+        }
+    };
+    constexpr int kSteps{10'000};
+    for (int i{0}; i < kSteps; ++i)
+    {
+        velocityVerletStep(std::span{x}, std::span{v}, std::span{a}, MilliSecond{1}, spring);
+    }
+    EXPECT_NEAR(x[0].count(), std::cos(10.0), 1e-5);
+    EXPECT_NEAR(v[3].count(), -std::sin(10.0), 1e-5);
+}
+
+TEST(integrate, rk4)
+{
+    // x' = -x / (2 s), i.e. x(t) = exp(-t / 2 s).
+    std::vector<Meter_double> x(3, Meter_double{1.0});
+    const auto decay = [](const Meter_double pos) {
+        return MeterPerSecond_double{-pos.count() / 2.0};
+    };
+    for (int i{0}; i < 20; ++i)
+    {
+        rk4Step(std::span{x}, Second_double{0.1}, decay);
+    }
+    EXPECT_NEAR(x[2].count(), std::exp(-1.0), 1e-7);
+}
+
+} // namespace cpu
@@ -0,0 +1,88 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_lookup_table
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/lookup_table.h"
+#include <cstddef>
+#include <ratio>
+#include <span>
+#include <vector>
+
+namespace cpu
+{
+using Newton_double = StorageUnit<Newton, double>;
+
+TEST(lookup_table, uniform_grid)
+{
+    // Traction force sampled every 10 km/h from 20 km/h.
+    using Traction = LookupTable<KmPerHour_double, Newton_double, std::ratio<10>>;
+    const std::vector<Newton_double> traction{Newton_double{0.5}, Newton_double{0.7},
+                                              Newton_double{0.8}, Newton_double{0.6}};
+    const std::optional<Traction> table{Traction::fromSamples(KmPerHour{20}, traction)};
+    ASSERT_TRUE(table.has_value());
+    EXPECT_EQ(table->size(), 4);
+
+    EXPECT_DOUBLE_EQ((*table)(KmPerHour{20}).count(), 0.5);
+    EXPECT_DOUBLE_EQ((*table)(KmPerHour{25}).count(), 0.6);
+    EXPECT_DOUBLE_EQ((*table)(KmPerHour{50}).count(), 0.6);
+    // Any castable unit is converted once, e.g. 12.5 m/s == 45 km/h.
+    EXPECT_DOUBLE_EQ((*table)(MeterPerSecond_double{12.5}).count(), 0.7);
+    // Clamped outside of the grid.
+    EXPECT_DOUBLE_EQ((*table)(KmPerHour{0}).count(), 0.5);
+    EXPECT_DOUBLE_EQ((*table)(KmPerHour{100}).count(), 0.6);
+
+    const std::vector<MeterPerSecond_double> speeds{MeterPerSecond_double{25.0 / 3.6},
+                                                    MeterPerSecond_double{12.5}};
+    std::vector<Newton_double> out(speeds.size());
+    table->interpolate(std::span{speeds}, std::span{out});
+    EXPECT_DOUBLE_EQ(out[0].count(), 0.6);
+    EXPECT_DOUBLE_EQ(out[1].count(), 0.7);
+
+    // The batch loop of the uniform grid matches the scalar path, the clamping included.
+    std::vector<KmPerHour_double> queries{};
+    for (int i{-20}; i < 100; ++i)
+    {
+        queries.push_back(KmPerHour_double{0.7 * i});
+    }
+    std::vector<Newton_double> batch(queries.size());
+    table->interpolate(std::span{queries}, std::span{batch});
+    for (std::size_t i{0}; i < queries.size(); ++i)
+    {
+        EXPECT_NEAR(batch[i].count(), (*table)(queries[i]).count(), 1e-12);
+    }
+
+    EXPECT_FALSE(Traction::fromSamples(KmPerHour{20}, std::span(traction).first(1)));
+
+    // The step as a constant of a castable unit, 10 km/h == 2.5 m/s * 10 / 9.
+    using Traction_constant =
+        LookupTable<MeterPerSecond_double, Newton_double, Constant<KmPerHour{10}>>;
+    const std::optional<Traction_constant> table_constant{
+        Traction_constant::fromSamples(KmPerHour{20}, traction)};
+    ASSERT_TRUE(table_constant.has_value());
+    EXPECT_DOUBLE_EQ((*table_constant)(KmPerHour{25}).count(), 0.6);
+    EXPECT_DOUBLE_EQ((*table_constant)(MeterPerSecond_double{12.5}).count(), 0.7);
+}
+
+TEST(lookup_table, non_uniform_grid)
+{
+    using Drag = LookupTable<MeterPerSecond_double, Newton_double>;
+    const std::vector<MeterPerSecond_double> speeds{
+        MeterPerSecond_double{0.0}, MeterPerSecond_double{1.0}, MeterPerSecond_double{4.0}};
+    const std::vector<Newton_double> drags{Newton_double{0.0}, Newton_double{2.0},
+                                           Newton_double{32.0}};
+    const std::optional<Drag> table{Drag::fromPoints(speeds, drags)};
+    ASSERT_TRUE(table.has_value());
+
+    EXPECT_DOUBLE_EQ((*table)(MeterPerSecond_double{0.5}).count(), 1.0);
+    EXPECT_DOUBLE_EQ((*table)(KmPerHour_double{9.0}).count(), 17.0);
+    EXPECT_DOUBLE_EQ((*table)(MeterPerSecond_double{-1.0}).count(), 0.0);
+    EXPECT_DOUBLE_EQ((*table)(MeterPerSecond_double{5.0}).count(), 32.0);
+    EXPECT_EQ((*table)(MeterPerSecond_double{4.0}), Newton{32});
+
+    const std::vector<MeterPerSecond_double> unordered{speeds[1], speeds[0], speeds[2]};
+    EXPECT_FALSE(Drag::fromPoints(unordered, drags));
+    EXPECT_FALSE(Drag::fromPoints(speeds, std::span(drags).first(2)));
+}
+} // namespace cpu
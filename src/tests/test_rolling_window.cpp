@@ -0,0 +1,105 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_rolling_window
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/rolling_window.h"
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace cpu
+{
+TEST(rolling_window, aggregations)
+{
+    // The window of one minute is converted once to the milliseconds of the timestamps.
+    RollingWindow<Meter, MilliSecond> window{Minute{1}};
+    EXPECT_EQ(window.window().count(), 60'000);
+    EXPECT_FALSE(window.mean().has_value());
+    EXPECT_FALSE(window.min().has_value());
+    EXPECT_FALSE(window.rate().has_value());
+
+    window.push(MilliSecond{0}, Meter{5});
+    EXPECT_FALSE(window.rate().has_value());
+    window.push(MilliSecond{20'000}, Meter{1});
+    window.push(MilliSecond{40'000}, Meter{6});
+    EXPECT_EQ(window.size(), 3);
+    EXPECT_EQ(window.min()->count(), 1);
+    EXPECT_EQ(window.max()->count(), 6);
+    static_assert(std::is_same_v<RollingWindow<Meter, MilliSecond>::MeanUnit, Meter_double>);
+    EXPECT_DOUBLE_EQ(window.mean()->count(), 4.0);
+
+    // (0, 60000] excludes the first sample.
+    window.push(MilliSecond{60'000}, Meter{3});
+    EXPECT_EQ(window.size(), 3);
+    EXPECT_EQ(window.max()->count(), 6);
+    EXPECT_DOUBLE_EQ(window.mean()->count(), 10.0 / 3.0);
+
+    window.push(MilliSecond{100'500}, Meter{4});
+    EXPECT_EQ(window.size(), 2);
+    EXPECT_EQ(window.min()->count(), 3);
+    EXPECT_EQ(window.max()->count(), 4);
+
+    window.clear();
+    EXPECT_TRUE(window.empty());
+    EXPECT_FALSE(window.max().has_value());
+}
+
+TEST(rolling_window, rate)
+{
+    // Speed from a cumulative distance.
+    RollingWindow<Km_double, Second> window{Second{11}};
+    for (int i{0}; i <= 20; ++i)
+    {
+        window.push(Second{i}, Km_double{0.002 * i * i});
+    }
+    // The samples of 10 s to 20 s, i.e. (0.8 - 0.2) km / 10 s.
+    EXPECT_EQ(window.size(), 11);
+    const auto rate = window.rate();
+    ASSERT_TRUE(rate.has_value());
+    EXPECT_NEAR(MeterPerSecond_double{*rate}.count(), 60.0, 1e-9);
+}
+
+TEST(rolling_window, window_conversion)
+{
+    // A window which would truncate in the integer timestamps is rejected.
+    static_assert(!std::is_constructible_v<RollingWindow<Meter, Second>, MilliSecond>);
+    static_assert(std::is_constructible_v<RollingWindow<Meter, Second>, Minute>);
+    static_assert(std::is_constructible_v<RollingWindow<Meter, Second_double>, MilliSecond>);
+
+    RollingWindow<Meter, Second_double> window{MilliSecond{500}};
+    EXPECT_DOUBLE_EQ(window.window().count(), 0.5);
+    window.push(Second_double{1.0}, Meter{1});
+    window.push(Second_double{1.25}, Meter{2});
+    EXPECT_EQ(window.size(), 2);
+    window.push(Second_double{1.75}, Meter{3});
+    EXPECT_EQ(window.size(), 1);
+}
+
+TEST(rolling_window, against_recompute)
+{
+    RollingWindow<Meter_double, Second> window{Second{7}};
+    std::vector<double> values{};
+    for (int i{0}; i < 1000; ++i)
+    {
+        const double value{static_cast<double>((i * 7919) % 101) * 1e6 + 0.125};
+        values.push_back(value);
+        window.push(Second{i / 3}, Meter_double{value});
+
+        // The samples of the last 7 seconds, 3 per second.
+        const std::size_t first{static_cast<std::size_t>(std::max(0, (i / 3 - 6) * 3))};
+        const std::vector<double> expected(values.begin() + static_cast<std::ptrdiff_t>(first),
+                                           values.end());
+        ASSERT_EQ(window.size(), expected.size());
+        ASSERT_EQ(window.min()->count(), *std::min_element(expected.begin(), expected.end()));
+        ASSERT_EQ(window.max()->count(), *std::max_element(expected.begin(), expected.end()));
+        ASSERT_DOUBLE_EQ(window.mean()->count(),
+                         std::accumulate(expected.begin(), expected.end(), 0.0) /
+                             static_cast<double>(expected.size()));
+    }
+}
+
+} // namespace cpu
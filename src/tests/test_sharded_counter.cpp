@@ -0,0 +1,67 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_sharded_counter
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/sharded_counter.h"
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace cpu
+{
+TEST(sharded_counter, concurrent_add)
+{
+    constexpr int kThreads{8};
+    constexpr int kIterations{10'000};
+
+    ShardedCounter<NanoSecond> latency{4};
+    EXPECT_EQ(latency.shards(), 4);
+    {
+        std::vector<std::jthread> threads{};
+        for (int t{0}; t < kThreads; ++t)
+        {
+            threads.emplace_back([&latency] {
+                for (int i{0}; i < kIterations; ++i)
+                {
+                    latency.add(MicroSecond{1});
+                    latency.add(NanoSecond{1});
+                }
+            });
+        }
+    }
+
+    const auto total = latency.snapshot();
+    using TotalType = std::remove_cv_t<decltype(total)>;
+    EXPECT_TRUE((compound_unit_helper::are_compound_units_castable_v<TotalType, NanoSecond>));
+    EXPECT_TRUE((std::ratio_equal_v<TotalType::Period, NanoSecond::Period>));
+    EXPECT_EQ(NanoSecond{total}.count(), kThreads * kIterations * 1001);
+
+    latency.reset();
+    EXPECT_EQ(NanoSecond{latency.snapshot()}.count(), 0);
+}
+
+TEST(sharded_counter, wide_total)
+{
+#if defined(__SIZEOF_INT128__)
+    ShardedCounter<NanoSecond> counter{2};
+    EXPECT_TRUE((std::same_as<decltype(counter)::TotalUnit::Rep, number_helper::int128_t>));
+
+    constexpr std::int64_t kMax{std::numeric_limits<std::int64_t>::max()};
+    std::jthread{[&counter] { counter.add(NanoSecond{kMax}); }}.join();
+    std::jthread{[&counter] { counter.add(NanoSecond{kMax}); }}.join();
+
+    // The total does not overflow, even though it exceeds the range of the Rep.
+    EXPECT_TRUE(counter.snapshot() > NanoSecond{kMax});
+    EXPECT_EQ((counter.snapshot() / 2).count(), kMax);
+    EXPECT_EQ(Second{counter.snapshot()}.count(), 18'446'744'073); // (2^64 - 2) ns
+#endif
+
+    ShardedCounter<CompoundUnit<float, UnitSignature<RatioOne, 1, LengthTag>>> length{};
+    length.add(CentiMeter{150});
+    EXPECT_TRUE((std::same_as<decltype(length)::TotalUnit::Rep, double>));
+    EXPECT_DOUBLE_EQ(length.snapshot().count(), 1.5);
+}
+} // namespace cpu
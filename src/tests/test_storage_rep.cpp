@@ -0,0 +1,126 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_storage_rep
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/compound_unit.h"
+#include "ypz/strong_type/storage_rep.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <vector>
+
+namespace cpu
+{
+TEST(float16, conversion)
+{
+    EXPECT_EQ(float16{1.0F}.bits(), 0x3C00);
+    EXPECT_EQ(float16{-2.0F}.bits(), 0xC000);
+    EXPECT_EQ(float16{65504.0F}.bits(), 0x7BFF);
+    EXPECT_EQ(float16{65520.0F}.bits(), 0x7C00); // Rounds to infinity.
+    EXPECT_EQ(float16{5.9604644775390625e-8F}.bits(), 0x0001); // Smallest subnormal.
+    EXPECT_EQ(float16{1.0F + 1.0F / 2048}.bits(), 0x3C00);     // Tie, rounds to even.
+    EXPECT_EQ(float16{1.0F + 3.0F / 2048}.bits(), 0x3C02);     // Tie, rounds to even.
+    EXPECT_TRUE(std::isnan(static_cast<float>(float16{NAN})));
+
+    for (std::uint32_t bits{0}; bits < 0x7C00; ++bits)
+    { // Every finite binary16 value round trips through float.
+        const float16 value{float16::fromBits(static_cast<std::uint16_t>(bits))};
+        ASSERT_EQ(float16{static_cast<float>(value)}.bits(), bits);
+    }
+}
+
+TEST(bfloat16, conversion)
+{
+    EXPECT_EQ(bfloat16{1.0F}.bits(), 0x3F80);
+    EXPECT_EQ(bfloat16{-2.0F}.bits(), 0xC000);
+    EXPECT_FLOAT_EQ(static_cast<float>(bfloat16{3.140625F}), 3.140625F);
+    EXPECT_EQ(bfloat16{1.0F + 1.0F / 256}.bits(), 0x3F80); // Tie, rounds to even.
+    EXPECT_TRUE(std::isnan(static_cast<float>(bfloat16{NAN})));
+}
+
+TEST(storage_unit, widen_in_operators)
+{
+    using Meter_half = StorageUnit<Meter_double, float16>;
+    using Second_half = StorageUnit<Second_double, float16>;
+    EXPECT_EQ(sizeof(Meter_half), 2);
+    EXPECT_TRUE((std::same_as<Meter_half::Rep, float16>));
+    EXPECT_TRUE((std::is_trivially_copyable_v<Meter_half>));
+
+    constexpr Meter_half distance{Meter_double{12.5}};
+    constexpr Second_half time{float16{2.5F}};
+
+    { // The result of an arithmetic operator is widened to the compute type.
+        constexpr auto ret = distance / time;
+        using ReturnType = std::remove_cv_t<decltype(ret)>;
+        EXPECT_TRUE((std::same_as<ReturnType::Rep, float>));
+        EXPECT_FLOAT_EQ(ret.count(), 5.0F);
+    }
+
+    {
+        constexpr auto ret = distance + Km{1};
+        using ReturnType = std::remove_cv_t<decltype(ret)>;
+        EXPECT_TRUE((std::same_as<ReturnType::Rep, float>));
+        EXPECT_FLOAT_EQ(ret.count(), 1012.5F);
+    }
+
+    {
+        constexpr auto ret = -distance * 2;
+        EXPECT_FLOAT_EQ(ret.count(), -25.0F);
+    }
+
+    { // Comparison with other castable units.
+        EXPECT_EQ((distance <=> CentiMeter{1250}), std::partial_ordering::equivalent);
+        EXPECT_EQ((distance <=> Meter_half{float16{1.0F}}), std::partial_ordering::greater);
+        EXPECT_TRUE(distance == Meter_half{float16{12.5F}});
+    }
+
+    { // Narrow back to storage.
+        const std::vector<Meter_half> archive{Meter_double{0.5}, MilliMeter{250}};
+        EXPECT_FLOAT_EQ(static_cast<Meter_double>(archive[1]).count(), 0.25);
+
+        using MeterPerSecond_bf16 = StorageUnit<MeterPerSecond_double, bfloat16>;
+        constexpr MeterPerSecond_bf16 speed{KmPerHour{36}};
+        EXPECT_EQ(sizeof(speed), 2);
+        EXPECT_FLOAT_EQ(number_helper::widen(speed.count()), 10.0F);
+    }
+}
+
+TEST(quantized_unit, scale_folded_into_period)
+{
+    using MilliMeter_i16 = QuantizedUnit<Meter_double, std::int16_t, std::milli>;
+    EXPECT_TRUE((std::same_as<MilliMeter_i16::Rep, std::int16_t>));
+    EXPECT_TRUE((std::ratio_equal_v<MilliMeter_i16::Period, std::milli>));
+    EXPECT_TRUE((compound_unit_helper::are_compound_units_castable_v<MilliMeter_i16, Meter>));
+
+    constexpr MilliMeter_i16 length{Meter_double{1.234}};
+    EXPECT_EQ(length.count(), 1234);
+    EXPECT_EQ((length <=> MilliMeter{1234}), std::partial_ordering::equivalent);
+
+    { // The results keep the built-in rep, a cast to a wider rep avoids the overflow.
+        static_assert(std::same_as<decltype(length + length), MilliMeter_i16>);
+        static_assert(std::same_as<decltype(-length), MilliMeter_i16>);
+        constexpr auto ret = StorageUnit<MilliMeter_i16, int>{length} * length;
+        using ReturnType = std::remove_cv_t<decltype(ret)>;
+        EXPECT_TRUE((std::same_as<ReturnType::Rep, int>));
+        EXPECT_EQ(ret.count(), 1234 * 1234);
+        EXPECT_TRUE((std::ratio_equal_v<ReturnType::Period, std::micro>));
+    }
+
+    { // The scale is folded into the first signature with exponent 1 or -1.
+        using Speed_i16 = QuantizedUnit<MeterPerSecond_double, std::int16_t, std::centi>;
+        EXPECT_TRUE((std::ratio_equal_v<Speed_i16::Period, std::centi>));
+        EXPECT_TRUE((std::same_as<Speed_i16::Signatures::type_at<0>,
+                                  UnitSignature<std::centi, 1, LengthTag>>));
+
+        using PerSecond_i16 = QuantizedUnit<
+            CompoundUnit<double, UnitSignature<RatioOne, -1, TimeTag>>, std::int16_t, std::kilo>;
+        EXPECT_TRUE((std::ratio_equal_v<PerSecond_i16::Period, std::kilo>));
+
+        constexpr Speed_i16 speed{KmPerHour_double{36.0}};
+        EXPECT_EQ(speed.count(), 1000);
+    }
+}
+} // namespace cpu
@@ -0,0 +1,191 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_stream_codec
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/stream_codec.h"
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace cpu
+{
+namespace
+{
+template <class CU>
+void expectExactRoundTrip(const std::vector<CU>& values)
+{
+    const std::vector<std::uint8_t> bytes{encodeStream<CU>(values)};
+    const auto decoded = decodeStream<CU>(bytes);
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_EQ(decoded->size(), values.size());
+    for (std::size_t i{0}; i < values.size(); ++i)
+    { // Compare the bits, so that NAN and -0.0 are checked too.
+        using Rep = typename CU::Rep;
+        using Bits = codec_helper::rep_bits_t<CU>;
+        ASSERT_EQ(std::bit_cast<Bits>((*decoded)[i]), std::bit_cast<Bits>(Rep{values[i].count()}))
+            << "at " << i;
+    }
+}
+} // namespace
+
+TEST(stream_codec, integer_round_trip)
+{
+    std::mt19937_64 rng{42};
+    std::vector<MilliMeter> values{};
+    std::int64_t position{1'000'000};
+    for (int i{0}; i < 10'000; ++i)
+    {
+        position += static_cast<std::int64_t>(rng() % 201) - 100;
+        values.emplace_back(position);
+    }
+    values.emplace_back(std::numeric_limits<std::int64_t>::max());
+    values.emplace_back(std::numeric_limits<std::int64_t>::min());
+    values.emplace_back(0);
+    expectExactRoundTrip(values);
+
+    using Second_i16 = CompoundUnit<std::int16_t, UnitSignature<RatioOne, 1, TimeTag>>;
+    expectExactRoundTrip(std::vector<Second_i16>{Second_i16{-32768}, Second_i16{32767},
+                                                 Second_i16{0}, Second_i16{-1}});
+
+    { // Slowly varying series compress well.
+        const std::vector<std::uint8_t> bytes{encodeStream<MilliMeter>(values)};
+        EXPECT_LT(bytes.size() * 4, values.size() * sizeof(std::int64_t));
+    }
+}
+
+TEST(stream_codec, float_round_trip)
+{
+    std::vector<MeterPerSecond_double> values{};
+    for (int i{0}; i < 10'000; ++i)
+    {
+        values.emplace_back(20.0 + 0.25 * static_cast<double>(i / 16));
+    }
+    values.emplace_back(NAN);
+    values.emplace_back(-0.0);
+    values.emplace_back(std::numeric_limits<double>::infinity());
+    values.emplace_back(std::numeric_limits<double>::denorm_min());
+    values.emplace_back(-1.0e300);
+    expectExactRoundTrip(values);
+
+    {
+        const std::vector<std::uint8_t> bytes{encodeStream<MeterPerSecond_double>(values)};
+        EXPECT_LT(bytes.size() * 4, values.size() * sizeof(double));
+    }
+
+    using Meter_float = CompoundUnit<float, UnitSignature<RatioOne, 1, LengthTag>>;
+    std::mt19937 rng{7};
+    std::uniform_real_distribution<float> dist{-1.0e6F, 1.0e6F};
+    std::vector<Meter_float> random_values{};
+    for (int i{0}; i < 1000; ++i)
+    {
+        random_values.emplace_back(dist(rng));
+    }
+    expectExactRoundTrip(random_values);
+}
+
+TEST(stream_codec, frames_and_partial_decode)
+{
+    std::vector<std::uint8_t> bytes{};
+    {
+        StreamEncoder<Second_double> encoder{bytes};
+        encoder.push(Second_double{1.0});
+        encoder.push(Minute{1}); // Castable units are converted.
+        encoder.flush();
+        const std::vector<Second_double> more{Second_double{60.5}, Second_double{61.0},
+                                              Second_double{61.5}};
+        encoder.push(more);
+    }
+
+    StreamDecoder<Second_double> decoder{bytes};
+    ASSERT_TRUE(decoder.valid());
+    std::vector<double> out(2);
+    EXPECT_EQ(decoder.decode(out), 2);
+    EXPECT_EQ(out, (std::vector<double>{1.0, 60.0}));
+    EXPECT_EQ(decoder.decode(out), 2);
+    EXPECT_EQ(out, (std::vector<double>{60.5, 61.0}));
+    EXPECT_FALSE(decoder.done());
+    EXPECT_EQ(decoder.decode(out), 1);
+    EXPECT_EQ(out[0], 61.5);
+    EXPECT_TRUE(decoder.done());
+    EXPECT_TRUE(decoder.valid());
+}
+
+TEST(stream_codec, many_frames_and_chunks)
+{ // Frames and chunks of random sizes, the decoder reads ahead past the end of a frame.
+    std::mt19937_64 rng{7};
+    std::uniform_int_distribution<std::size_t> size_dist{1, 300};
+    std::vector<MilliMeter> lengths{};
+    std::vector<Meter_double> positions{};
+    std::vector<std::uint8_t> length_bytes{};
+    std::vector<std::uint8_t> position_bytes{};
+    {
+        StreamEncoder<MilliMeter> length_encoder{length_bytes};
+        StreamEncoder<Meter_double> position_encoder{position_bytes};
+        std::normal_distribution<double> dist{0.0, 1e9};
+        while (lengths.size() < 20'000)
+        {
+            for (std::size_t i{size_dist(rng)}; i > 0; --i)
+            {
+                lengths.push_back(MilliMeter{static_cast<std::int64_t>(dist(rng))});
+                positions.push_back(Meter_double{i % 3 == 0 ? 1.5 : dist(rng)});
+                length_encoder.push(lengths.back());
+                position_encoder.push(positions.back());
+            }
+            length_encoder.flush();
+            position_encoder.flush();
+        }
+    }
+
+    StreamDecoder<MilliMeter> length_decoder{length_bytes};
+    StreamDecoder<Meter_double> position_decoder{position_bytes};
+    std::vector<std::int64_t> length_counts{};
+    std::vector<double> position_counts{};
+    while (!length_decoder.done() || !position_decoder.done())
+    {
+        std::vector<std::int64_t> length_chunk(size_dist(rng));
+        length_chunk.resize(length_decoder.decode(length_chunk));
+        length_counts.insert(length_counts.end(), length_chunk.begin(), length_chunk.end());
+        std::vector<double> position_chunk(size_dist(rng));
+        position_chunk.resize(position_decoder.decode(position_chunk));
+        position_counts.insert(position_counts.end(), position_chunk.begin(),
+                               position_chunk.end());
+    }
+    ASSERT_TRUE(length_decoder.valid());
+    ASSERT_TRUE(position_decoder.valid());
+    ASSERT_EQ(length_counts.size(), lengths.size());
+    ASSERT_EQ(position_counts.size(), positions.size());
+    for (std::size_t i{0}; i < lengths.size(); ++i)
+    {
+        ASSERT_EQ(length_counts[i], lengths[i].count()) << "at " << i;
+        ASSERT_EQ(position_counts[i], positions[i].count()) << "at " << i;
+    }
+}
+
+TEST(stream_codec, header_check)
+{
+    const std::vector<Meter> values{Meter{1}, Meter{2}};
+    std::vector<std::uint8_t> bytes{encodeStream<Meter>(values)};
+
+    EXPECT_NE(unit_fingerprint_v<Meter>, unit_fingerprint_v<Km>);
+    EXPECT_EQ(unit_fingerprint_v<SquareMeter>, (unit_fingerprint_v<MultiplyUnit<Meter, Meter>>));
+    EXPECT_NE(unit_fingerprint_v<Meter>, unit_fingerprint_v<Meter_double>);
+    // The fingerprint is the one of the size of the rep, not of its spelling.
+    using MeterLong = CompoundUnit<long, UnitSignature<RatioOne, 1, LengthTag>>;
+    using MeterLongLong = CompoundUnit<long long, UnitSignature<RatioOne, 1, LengthTag>>;
+    EXPECT_EQ(unit_fingerprint_v<MeterLong> == unit_fingerprint_v<MeterLongLong>,
+              sizeof(long) == sizeof(long long));
+
+    EXPECT_TRUE(decodeStream<Meter>(bytes).has_value());
+    EXPECT_FALSE(decodeStream<Km>(bytes).has_value());     // Another unit.
+    EXPECT_FALSE(decodeStream<Second>(bytes).has_value()); // Another dimension.
+
+    bytes.pop_back(); // Truncated.
+    EXPECT_FALSE(decodeStream<Meter>(bytes).has_value());
+    EXPECT_FALSE(decodeStream<Meter>(std::vector<std::uint8_t>{}).has_value());
+}
+} // namespace cpu
@@ -0,0 +1,86 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_timer
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/timer.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <ratio>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cpu
+{
+namespace
+{
+using MilliSecond_double = CompoundUnit<double, UnitSignature<std::milli, 1, TimeTag>>;
+using Ticks = TscTicks<TimeTag>;
+} // namespace
+
+TEST(timer, calibrate)
+{
+    EXPECT_TRUE(std::isnan(tsc_period.period()));
+    ensureTscCalibrated();
+    EXPECT_FALSE(std::isnan(tsc_period.period()));
+
+    const double period{calibrateTsc(std::chrono::milliseconds{5})};
+    // Between 0.01 ns and 1 us per tick.
+    EXPECT_GT(period, 1e-11);
+    EXPECT_LT(period, 1e-6);
+    EXPECT_DOUBLE_EQ(tsc_period.period(), period);
+    static_assert(sizeof(Ticks) == sizeof(std::uint64_t));
+
+    const auto ticks = static_cast<std::uint64_t>(0.01 / period);
+    EXPECT_NEAR(Ticks{ticks}.as<MilliSecond_double>().count(), 10.0, 1e-3);
+    EXPECT_EQ(Ticks{ticks}.as<Second>().count(), 0);
+}
+
+TEST(timer, stopwatch)
+{
+    calibrateTsc(std::chrono::milliseconds{5});
+    Stopwatch<TimeTag> stopwatch{};
+    std::this_thread::sleep_for(std::chrono::milliseconds{2});
+    const Ticks lap{stopwatch.lap()};
+    EXPECT_GE(lap.as<MilliSecond_double>().count(), 1.5);
+    EXPECT_LT(stopwatch.elapsed(), lap);
+}
+
+TEST(timer, scoped_timer)
+{
+    calibrateTsc(std::chrono::milliseconds{5});
+    takeSpans();
+    for (int i{0}; i < 3000; ++i)
+    {
+        const ScopedTimer<TimeTag> timer{"loop"};
+    }
+    std::thread{[] {
+        const ScopedTimer<TimeTag> timer{"thread"};
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }}.join();
+
+    const std::vector<RecordedSpan> spans{takeSpans()};
+    ASSERT_EQ(spans.size(), 3001);
+    std::size_t loops{0};
+    for (const RecordedSpan& span : spans)
+    {
+        if (span.name == "loop")
+        {
+            ++loops;
+            EXPECT_EQ(span.thread, std::this_thread::get_id());
+        }
+        else
+        {
+            EXPECT_EQ(span.name, "thread");
+            EXPECT_GE(span.duration<TimeTag>().as<MicroSecond>().count(), 500);
+        }
+    }
+    EXPECT_EQ(loops, 3000);
+    EXPECT_TRUE(takeSpans().empty());
+}
+
+} // namespace cpu
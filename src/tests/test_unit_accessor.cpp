@@ -0,0 +1,67 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_unit_accessor
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/unit_accessor.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace cpu
+{
+TEST(unit_accessor, scale_on_access)
+{
+    using Accessor = unit_accessor<MeterPerSecond_double, KmPerHour_double>;
+    static_assert(std::is_same_v<Accessor::reference, KmPerHour_double>);
+    static_assert(std::is_same_v<Accessor::data_handle_type, const double*>);
+
+    // A 2 x 3 row-major grid of m/s, viewed in km/h.
+    const std::array<double, 6> grid{0.0, 1.0, 2.0, 10.0, 20.0, 30.0};
+    const Accessor accessor{};
+    const Accessor::data_handle_type row{accessor.offset(grid.data(), 3)};
+    EXPECT_DOUBLE_EQ(accessor.access(row, 0).count(), 36.0);
+    EXPECT_DOUBLE_EQ(accessor.access(row, 2).count(), 108.0);
+    EXPECT_DOUBLE_EQ(accessor.access(grid.data(), 1).count(), 3.6);
+
+    // An integer target truncates like castAs.
+    constexpr std::array<double, 1> slow{0.5};
+    static_assert(unit_accessor<MeterPerSecond_double, KmPerHour>{}.access(slow.data(), 0) ==
+                  KmPerHour{1});
+}
+
+TEST(unit_accessor, native_period)
+{
+    static_assert(std::is_same_v<native_unit_accessor<Meter>::reference, Meter&>);
+    static_assert(
+        std::is_same_v<native_unit_accessor<const Meter>::data_handle_type, const std::int64_t*>);
+
+    std::array<std::int64_t, 4> counts{1, 2, 3, 4};
+    const native_unit_accessor<Meter> accessor{};
+    Meter& length{accessor.access(counts.data(), 1)};
+    length = length + Km{1};
+    EXPECT_EQ(counts[1], 1002);
+
+    const native_unit_accessor<const Meter> read_only{accessor};
+    EXPECT_EQ(read_only.access(read_only.offset(counts.data(), 2), 1), Meter{4});
+}
+
+#if defined(__cpp_lib_mdspan)
+TEST(unit_accessor, mdspan)
+{
+    const std::array<double, 6> grid{0.0, 1.0, 2.0, 10.0, 20.0, 30.0};
+    const unit_mdspan<KmPerHour_double, std::extents<std::size_t, 2, 3>, MeterPerSecond_double>
+        view{grid.data()};
+    EXPECT_DOUBLE_EQ(view[1, 2].count(), 108.0);
+
+    std::array<double, 6> meters{};
+    const native_unit_mdspan<Meter_double, std::dextents<std::size_t, 2>> lengths{meters.data(), 2,
+                                                                                   3};
+    lengths[1, 0] = Km_double{1.5};
+    EXPECT_DOUBLE_EQ(meters[3], 1500.0);
+}
+#endif
+
+} // namespace cpu
@@ -0,0 +1,117 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_unit_array
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/unit_array.h"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace cpu
+{
+template <class L, class R>
+concept Addable = requires(const L& lhs, const R& rhs) { lhs + rhs; };
+
+template <class L, class R>
+concept Dividable = requires(const L& lhs, const R& rhs) { lhs / rhs; };
+
+using MeterPerSecondSquare_double = DivideUnit<MeterPerSecond_double, Second_double>;
+
+TEST(unit_array, fused_expression)
+{
+    UnitArray<Meter_double> pos{3, Meter_double{1.0}};
+    UnitArray<MeterPerSecond_double> vel{3, MeterPerSecond_double{2.0}};
+    UnitArray<MeterPerSecondSquare_double> acc{3};
+    acc[1] = MeterPerSecondSquare_double{4.0};
+    const Second_double dt{0.5};
+
+    const auto expr = pos + vel * dt + 0.5 * acc * dt * dt;
+    // The expression is lazy, and its unit is checked at compile time.
+    EXPECT_FALSE((std::same_as<std::remove_cvref_t<decltype(expr)>, UnitArray<Meter_double>>));
+    EXPECT_TRUE((compound_unit_helper::are_compound_unit_equal_v<
+                 std::remove_cvref_t<decltype(expr)>::Unit, Meter_double>));
+    EXPECT_EQ(expr.size(), 3);
+
+    pos = expr;
+    EXPECT_DOUBLE_EQ(pos[0].count(), 2.0);
+    EXPECT_DOUBLE_EQ(pos[1].count(), 2.5);
+    EXPECT_DOUBLE_EQ(pos[2].count(), 2.0);
+
+    pos -= vel * dt;
+    EXPECT_DOUBLE_EQ(pos[1].count(), 1.5);
+    pos += Meter_double{1.0};
+    EXPECT_DOUBLE_EQ(pos[1].count(), 2.5);
+
+    const UnitArray<Meter_double> neg = -pos;
+    EXPECT_DOUBLE_EQ(neg[1].count(), -2.5);
+}
+
+TEST(unit_array, castable_units)
+{
+    UnitArray<KmPerHour_double> speed{2, KmPerHour_double{36.0}};
+    speed[1] = KmPerHour_double{72.0};
+
+    // The period ratios are folded into the element-wise operators.
+    const UnitArray<MeterPerSecond_double> converted{speed};
+    EXPECT_DOUBLE_EQ(converted[0].count(), 10.0);
+    EXPECT_DOUBLE_EQ(converted[1].count(), 20.0);
+
+    const UnitArray<Meter_double> distance = speed * Minute_double{1.0} + converted * Second{30};
+    EXPECT_DOUBLE_EQ(distance[0].count(), 900.0);
+    EXPECT_DOUBLE_EQ(distance[1].count(), 1800.0);
+
+    UnitArray<CentiMeter> cm{2, CentiMeter{50}};
+    const UnitArray<Meter_double> sum = distance + cm;
+    EXPECT_DOUBLE_EQ(sum[0].count(), 900.5);
+
+    // Contiguous storage.
+    const std::span<const Meter_double> view{sum};
+    EXPECT_EQ(view.size(), 2);
+    EXPECT_DOUBLE_EQ(view[1].count(), 1800.5);
+}
+
+TEST(unit_array, dimension_check)
+{
+    EXPECT_TRUE((Addable<UnitArray<Meter>, UnitArray<Km_double>>));
+    EXPECT_TRUE((Addable<UnitArray<Meter>, Km>));
+    EXPECT_FALSE((Addable<UnitArray<Meter>, UnitArray<Second>>));
+    EXPECT_FALSE((Addable<UnitArray<Meter>, Second>));
+    EXPECT_FALSE((Addable<Meter, Second>));
+    EXPECT_TRUE((Dividable<UnitArray<Meter>, UnitArray<Second>>));
+    // A dimensionless element is not a compound unit.
+    EXPECT_FALSE((Dividable<UnitArray<Meter>, UnitArray<Km>>));
+}
+
+TEST(unit_array, uninitialized)
+{
+    // The allocator leaves the elements of a vector uninitialized.
+    std::vector<Meter_double, DefaultInitAllocator<Meter_double>> buffer(4);
+    buffer.assign(4, Meter_double{1.0});
+    buffer.resize(8);
+    EXPECT_DOUBLE_EQ(buffer[3].count(), 1.0);
+    // The new elements are indeterminate, they are assigned before the copy reads them.
+    for (std::size_t i{4}; i < buffer.size(); ++i)
+    {
+        buffer[i] = Meter_double{2.0};
+    }
+    const std::vector<Meter_double, DefaultInitAllocator<Meter_double>> copy{buffer};
+    EXPECT_DOUBLE_EQ(copy[0].count(), 1.0);
+    EXPECT_DOUBLE_EQ(copy[7].count(), 2.0);
+
+    UnitArray<Meter> lengths(3, uninit);
+    ASSERT_EQ(lengths.size(), 3);
+    for (std::size_t i{0}; i < lengths.size(); ++i)
+    {
+        lengths[i] = Meter{static_cast<std::int64_t>(i)};
+    }
+    lengths.resize(5, uninit);
+    ASSERT_EQ(lengths.size(), 5);
+    EXPECT_EQ(lengths[2], Meter{2});
+    lengths.resize(6);
+    EXPECT_EQ(lengths[5], Meter{0});
+}
+} // namespace cpu
@@ -0,0 +1,81 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_unit_table
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/unit_table.h"
+#include <span>
+
+namespace cpu
+{
+namespace
+{
+struct Position
+{};
+
+struct Velocity
+{};
+
+struct Mass
+{};
+
+using Bodies = UnitTable<Column<Position, Meter_double>, Column<Velocity, MeterPerSecond_double>,
+                         Column<Mass, Kg>>;
+} // namespace
+
+TEST(unit_table, columns_and_rows)
+{
+    EXPECT_EQ(Bodies::index_of<Velocity>, 1);
+    EXPECT_TRUE((std::same_as<Bodies::unit_of<Mass>, Kg>));
+
+    Bodies bodies{};
+    bodies.push_back(Meter{1}, KmPerHour{36}, Kg{2});
+    bodies.push_back(Km_double{0.5}, MeterPerSecond{-1}, Kg{3});
+    EXPECT_EQ(bodies.size(), 2);
+
+    { // Typed column spans.
+        const std::span<MeterPerSecond_double> velocity{bodies.column<Velocity>()};
+        EXPECT_DOUBLE_EQ(velocity[0].count(), 10.0);
+        EXPECT_TRUE((std::same_as<decltype(bodies.column<2>()), std::span<Kg>>));
+    }
+
+    { // Row proxies.
+        auto row = bodies[1];
+        EXPECT_DOUBLE_EQ(row.get<Position>().count(), 500.0);
+        row.get<Mass>() = Kg{5};
+        EXPECT_EQ(bodies.column<Mass>()[1].count(), 5);
+
+        const Bodies& const_bodies{bodies};
+        EXPECT_EQ(const_bodies[1].get<2>().count(), 5);
+        EXPECT_TRUE((std::same_as<decltype(const_bodies[1].get<Mass>()), const Kg&>));
+    }
+
+    bodies.resize(3);
+    EXPECT_EQ(bodies.column<Mass>()[2].count(), 0);
+}
+
+TEST(unit_table, column_wise_kernels)
+{
+    Bodies bodies{};
+    bodies.push_back(Meter{0}, MeterPerSecond{10}, Kg{2});
+    bodies.push_back(Meter{100}, MeterPerSecond{-4}, Kg{3});
+
+    const Minute_double dt{0.5};
+    bodies.update<Position, Position, Velocity>(
+        [dt](const Meter_double p, const MeterPerSecond_double v) { return p + v * dt; });
+    EXPECT_DOUBLE_EQ(bodies.column<Position>()[0].count(), 300.0);
+    EXPECT_DOUBLE_EQ(bodies.column<Position>()[1].count(), -20.0);
+
+    using Momentum = MultiplyUnit<Kg, MeterPerSecond_double>;
+    const Momentum momentum = bodies.accumulate<Mass, Velocity>(
+        Momentum{}, [](const Momentum p, const Kg m, const MeterPerSecond_double v) {
+            return p + m * v;
+        });
+    EXPECT_DOUBLE_EQ(momentum.count(), 2 * 10.0 - 3 * 4.0);
+
+    const Kg total_mass =
+        bodies.accumulate<Mass>(Kg{}, [](const Kg total, const Kg m) { return total + m; });
+    EXPECT_EQ(total_mass.count(), 5);
+}
+} // namespace cpu
@@ -0,0 +1,84 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_unit_views
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/unit_views.h"
+#include <cstdint>
+#include <ranges>
+#include <ratio>
+#include <type_traits>
+#include <vector>
+
+namespace cpu
+{
+namespace
+{
+using MilliSecond_double = CompoundUnit<double, UnitSignature<std::milli, 1, TimeTag>>;
+} // namespace
+
+TEST(unit_views, adaptors)
+{
+    const std::vector<double> raw{10.0, 20.0, -5.0};
+
+    const auto speeds = raw | views::as_unit<MeterPerSecond_double>;
+    static_assert(std::ranges::random_access_range<decltype(speeds)>);
+    static_assert(std::ranges::sized_range<decltype(speeds)>);
+    static_assert(std::is_same_v<std::ranges::range_value_t<decltype(speeds)>,
+                                 MeterPerSecond_double>);
+    EXPECT_DOUBLE_EQ(speeds[1].count(), 20.0);
+
+    const auto kmh = speeds | views::unit_cast<KmPerHour_double>;
+    EXPECT_DOUBLE_EQ(kmh[0].count(), 36.0);
+    EXPECT_DOUBLE_EQ(kmh[2].count(), -18.0);
+
+    const auto counts = raw | views::as_unit<MeterPerSecond_double> |
+                        views::unit_cast<KmPerHour_double> | views::count;
+    static_assert(std::is_same_v<std::ranges::range_value_t<decltype(counts)>, double>);
+    EXPECT_DOUBLE_EQ(counts[1], 72.0);
+
+    const auto halved = kmh | views::scale<std::ratio<1, 2>>;
+    EXPECT_DOUBLE_EQ(halved[0].count(), 18.0);
+    EXPECT_EQ(std::ranges::size(halved), 3);
+}
+
+TEST(unit_views, fusion)
+{
+    const std::vector<Meter> lengths{Meter{1500}, Meter{2499}};
+    // The chain is one transform view over the vector, with the combined ratio.
+    const auto chained =
+        lengths | views::unit_cast<CentiMeter> | views::unit_cast<MilliMeter> |
+        views::unit_cast<Km_double>;
+    const auto direct = lengths | views::unit_cast<Km_double>;
+    static_assert(std::is_same_v<decltype(chained), decltype(direct)>);
+    EXPECT_DOUBLE_EQ(chained[0].count(), 1.5);
+
+    // An integer chain rounds once, 2499 m * 1/1000 * 1000.
+    const auto round_trip = lengths | views::unit_cast<Km> | views::unit_cast<Meter> | views::count;
+    EXPECT_EQ(round_trip[1], 2499);
+    EXPECT_EQ((lengths | views::unit_cast<Km> | views::count)[1], 2);
+
+    const auto scaled = lengths | views::scale<std::kilo> | views::count | views::scale<std::milli>;
+    static_assert(
+        std::is_same_v<std::remove_const_t<decltype(scaled)>, decltype(lengths | views::count)>);
+    EXPECT_EQ(scaled[0], 1500);
+
+    static_assert(
+        !std::is_invocable_v<decltype(views::unit_cast<Second>), const std::vector<Meter>&>);
+    static_assert(!std::is_invocable_v<decltype(views::count), const std::vector<double>&>);
+}
+
+TEST(unit_views, call_syntax)
+{
+    std::vector<std::int32_t> ticks{1, 2, 3};
+    std::vector<double> out{};
+    for (const double ms : views::count(views::unit_cast<MilliSecond_double>(
+             views::as_unit<Second>(ticks))))
+    {
+        out.push_back(ms);
+    }
+    EXPECT_EQ(out, (std::vector<double>{1000.0, 2000.0, 3000.0}));
+}
+
+} // namespace cpu
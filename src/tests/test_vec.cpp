@@ -0,0 +1,142 @@
+/*
+bazelisk run --config=cpp20 //src/tests:test_vec
+*/
+#include <gtest/gtest.h>
+
+#include "compound_unit_def.h"
+#include "ypz/strong_type/vec.h"
+#include <cmath>
+#include <vector>
+
+namespace cpu
+{
+TEST(vec, layout)
+{
+    EXPECT_EQ((Vec<Meter_double, 3>::padded_size()), 4);
+    EXPECT_EQ(sizeof(Vec<Meter_double, 3>), 32);
+    EXPECT_EQ(alignof(Vec<Meter_double, 3>), 32);
+    EXPECT_EQ(alignof(Vec<Meter_double, 16>), 64);
+    EXPECT_TRUE((std::is_trivially_copyable_v<Vec<Meter_double, 3>>));
+}
+
+TEST(vec, construct_and_access)
+{
+    constexpr Vec<Meter, 3> v{Meter{1}, Km{2}, CentiMeter_double{300.0}};
+    EXPECT_EQ(v[0].count(), 1);
+    EXPECT_EQ(v[1].count(), 2000);
+    EXPECT_EQ(v[2].count(), 3);
+
+    constexpr Vec<CentiMeter, 3> v_cm = v;
+    EXPECT_EQ(v_cm[1].count(), 200'000);
+
+    Vec<Meter, 3> w{};
+    w.set(1, Km{1});
+    EXPECT_EQ(w, (Vec<Meter, 3>{Meter{0}, Meter{1000}, Meter{0}}));
+}
+
+TEST(vec, element_wise_operators)
+{
+    constexpr Vec<Meter, 3> a{Meter{1}, Meter{2}, Meter{3}};
+    constexpr Vec<CentiMeter, 3> b{CentiMeter{10}, CentiMeter{20}, CentiMeter{30}};
+
+    { // Castable units, the element type is the common unit.
+        constexpr auto ret = a + b;
+        using ReturnUnit = std::remove_cv_t<decltype(ret)>::Unit;
+        EXPECT_TRUE((compound_unit_helper::are_compound_unit_equal_v<ReturnUnit, CentiMeter>));
+        EXPECT_EQ(ret[2].count(), 330);
+        EXPECT_EQ((a - b)[0].count(), 90);
+        EXPECT_EQ((-a)[1].count(), -2);
+    }
+
+    { // Scalars.
+        constexpr auto ret = 0.5 * a;
+        EXPECT_DOUBLE_EQ(ret[0].count(), 0.5);
+        EXPECT_DOUBLE_EQ((a / 2.0)[2].count(), 1.5);
+    }
+
+    { // Scaling by units changes the element type.
+        constexpr Vec<MeterPerSecond_double, 3> velocity{
+            MeterPerSecond_double{1.0}, MeterPerSecond_double{-2.0}, KmPerHour_double{36.0}};
+        constexpr auto displacement = velocity * Minute{1};
+        using ReturnUnit = std::remove_cv_t<decltype(displacement)>::Unit;
+        EXPECT_TRUE((compound_unit_helper::are_compound_unit_equal_v<ReturnUnit, Meter_double>));
+        EXPECT_DOUBLE_EQ(displacement[1].count(), -120.0);
+        EXPECT_DOUBLE_EQ(displacement[2].count(), 600.0);
+
+        constexpr auto back = displacement / Second{60};
+        EXPECT_DOUBLE_EQ(back[2].count(), 10.0);
+
+        constexpr Vec<Meter_double, 3> as_meter = Second{2} * velocity;
+        EXPECT_DOUBLE_EQ(as_meter[0].count(), 2.0);
+    }
+}
+
+TEST(vec, dot_cross_norm)
+{
+    constexpr Vec<Meter, 3> a{Meter{1}, Meter{2}, Meter{3}};
+    constexpr Vec<Meter, 3> b{Meter{4}, Meter{5}, Meter{6}};
+
+    {
+        constexpr auto ret = dot(a, b);
+        EXPECT_TRUE((std::same_as<std::remove_cv_t<decltype(ret)>, MultiplyUnit<Meter, Meter>>));
+        EXPECT_EQ(ret.count(), 32);
+    }
+
+    {
+        constexpr Vec<MeterPerSecond, 3> f{MeterPerSecond{0}, MeterPerSecond{0}, MeterPerSecond{1}};
+        constexpr auto ret = cross(a, f);
+        using ReturnUnit = std::remove_cv_t<decltype(ret)>::Unit;
+        EXPECT_TRUE(
+            (compound_unit_helper::are_compound_unit_equal_v<ReturnUnit,
+                                                             MultiplyUnit<Meter, MeterPerSecond>>));
+        EXPECT_EQ(ret[0].count(), 2);
+        EXPECT_EQ(ret[1].count(), -1);
+        EXPECT_EQ(ret[2].count(), 0);
+    }
+
+    { // Dimensionless dot product.
+        using PerMeter = CompoundUnit<std::int64_t, UnitSignature<RatioOne, -1, LengthTag>>;
+        constexpr Vec<PerMeter, 3> k{PerMeter{1}, PerMeter{1}, PerMeter{1}};
+        EXPECT_EQ(dot(a, k), 6);
+    }
+
+    {
+        const auto ret = norm(Vec<Meter, 2>{Meter{3}, Meter{4}});
+        EXPECT_TRUE((compound_unit_helper::are_compound_unit_equal_v<
+                     std::remove_cv_t<decltype(ret)>, Meter_double>));
+        EXPECT_DOUBLE_EQ(ret.count(), 5.0);
+    }
+}
+
+TEST(vec, batch_add_product)
+{
+    constexpr std::size_t kSize{1000};
+    const Second_double dt{0.5};
+
+    { // Array of structs.
+        std::vector<Vec<Meter_double, 3>> position(kSize);
+        std::vector<Vec<KmPerHour_double, 3>> velocity(
+            kSize, Vec<KmPerHour_double, 3>{KmPerHour_double{36.0}, KmPerHour_double{0.0},
+                                            KmPerHour_double{-7.2}});
+        addProduct(std::span{position}, std::span<const Vec<KmPerHour_double, 3>>{velocity}, dt);
+        addProduct(std::span{position}, std::span<const Vec<KmPerHour_double, 3>>{velocity}, dt);
+        EXPECT_DOUBLE_EQ(position[kSize - 1][0].count(), 10.0);
+        EXPECT_DOUBLE_EQ(position[kSize - 1][2].count(), -2.0);
+    }
+
+    { // Struct of arrays.
+        VecArray<Meter_double, 3> position{kSize};
+        VecArray<KmPerHour_double, 3> velocity{kSize};
+        for (std::size_t i{0}; i < kSize; ++i)
+        {
+            velocity.set(i, Vec<KmPerHour_double, 3>{KmPerHour_double{36.0}, KmPerHour_double{0.0},
+                                                     KmPerHour_double{-7.2}});
+        }
+        addProduct(position, velocity, dt);
+        addProduct(position, velocity, dt);
+        EXPECT_EQ(position.size(), kSize);
+        EXPECT_DOUBLE_EQ(position[kSize - 1][0].count(), 10.0);
+        EXPECT_DOUBLE_EQ(position.component(2)[0], -2.0);
+    }
+}
+} // namespace cpu
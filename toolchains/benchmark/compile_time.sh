@@ -0,0 +1,48 @@
+# Measure the clean build time of N translation units which use the strong type library, either
+# by including the headers (as //src:strong_type does) or by importing the module ypz.strong_type.
+#
+# Usage: bash toolchains/benchmark/compile_time.sh [N]
+# Set CXX to choose the compiler, e.g. CXX=clang++-18. The compiler must support -fmodules-ts
+# (gcc) or -fmodules (clang) for the import variant.
+set -e
+
+num_tus=${1:-20}
+cxx=${CXX:-g++}
+repo_dir=$(pwd)
+include_dir=$repo_dir/src/include
+work_dir=$(mktemp -d)
+trap 'rm -rf "$work_dir"' EXIT
+
+if [[ "$cxx" == *clang* ]]; then
+    module_flags="-fmodules -fprebuilt-module-path=$work_dir"
+    precompile="$cxx -std=c++20 -I$include_dir --precompile -x c++-module \
+        $repo_dir/src/module/ypz.strong_type.cppm -o $work_dir/ypz.strong_type.pcm"
+else
+    module_flags="-fmodules-ts"
+    precompile="$cxx -std=c++20 -fmodules-ts -I$include_dir -x c++ -c \
+        $repo_dir/src/module/ypz.strong_type.cppm -o $work_dir/module.o"
+fi
+
+for i in $(seq 1 "$num_tus"); do
+    body="struct L$i{}; struct T$i{};
+using M$i = cpu::CompoundUnit<std::int64_t, cpu::UnitSignature<std::ratio<1>, 1, L$i>>;
+using S$i = cpu::CompoundUnit<double, cpu::UnitSignature<std::milli, 1, T$i>>;
+double f$i() { return (M$i{$i} / S$i{2.0} + M$i{1} / S$i{1.0}).count(); }"
+    printf '#include "ypz/strong_type/strong_type.h"\n%s\n' "$body" > "$work_dir/include_$i.cpp"
+    printf '#include <compare>\n#include <cstdint>\n#include <ratio>\nimport ypz.strong_type;\n%s\n' \
+        "$body" > "$work_dir/import_$i.cpp"
+done
+
+TIMEFORMAT="%R"
+
+echo "Compiling $num_tus TUs with $cxx"
+include_time=$({ time (for i in $(seq 1 "$num_tus"); do
+    $cxx -std=c++20 -I"$include_dir" -c "$work_dir/include_$i.cpp" -o "$work_dir/include_$i.o"
+done) ; } 2>&1)
+echo "#include: ${include_time}s"
+
+import_time=$({ time (
+    cd "$work_dir" && eval "$precompile" && for i in $(seq 1 "$num_tus"); do
+        $cxx -std=c++20 $module_flags -I"$include_dir" -c "import_$i.cpp" -o "import_$i.o"
+    done) ; } 2>&1)
+echo "import (including the module interface): ${import_time}s"
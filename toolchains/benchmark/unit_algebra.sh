@@ -0,0 +1,47 @@
+# Measure the compile time of a heavy translation unit of unit algebra, with the tag based
+# CompoundUnit and with the exponent-vector DimensionUnit.
+#
+# Usage: bash toolchains/benchmark/unit_algebra.sh [N]
+# N is the number of distinct derived units. Set CXX to choose the compiler.
+set -e
+
+num_units=${1:-200}
+cxx=${CXX:-g++}
+repo_dir=$(pwd)
+include_dir=$repo_dir/src/include
+work_dir=$(mktemp -d)
+trap 'rm -rf "$work_dir"' EXIT
+
+tags="struct T0{}; struct T1{}; struct T2{}; struct T3{}; struct T4{}; struct T5{}; struct T6{};"
+system="using System = cpu::DimensionSystem<T0, T1, T2, T3, T4, T5, T6>;"
+base="template <int I, int P> using B = cpu::CompoundUnit<std::int64_t,
+    cpu::UnitSignature<std::ratio<P>, 1, T0>, cpu::UnitSignature<std::ratio<1>, 1, T1>,
+    cpu::UnitSignature<std::ratio<1>, -1, T2>, cpu::UnitSignature<std::ratio<1>, I % 3 + 1, T3>>;
+template <int P> using C = cpu::CompoundUnit<std::int64_t,
+    cpu::UnitSignature<std::ratio<P>, 1, T2>, cpu::UnitSignature<std::ratio<1>, 2, T4>,
+    cpu::UnitSignature<std::ratio<1>, 1, T5>, cpu::UnitSignature<std::ratio<1>, 1, T6>>;"
+
+{
+    printf '#include "ypz/strong_type/compound_unit.h"\n%s\n%s\n' "$tags" "$base"
+    for i in $(seq 1 "$num_units"); do
+        echo "auto f$i() { return B<$i, $i>{1} * C<$((i % 7 + 1))>{2} / B<$((i + 1)), 1>{3}; }"
+    done
+} > "$work_dir/tag.cpp"
+
+{
+    printf '#include "ypz/strong_type/dimension_unit.h"\n%s\n%s\n%s\n' "$tags" "$base" "$system"
+    echo "template <int I, int P> using DB = cpu::to_dimension_unit_t<System, B<I, P>>;"
+    echo "template <int P> using DC = cpu::to_dimension_unit_t<System, C<P>>;"
+    for i in $(seq 1 "$num_units"); do
+        echo "auto f$i() { return DB<$i, $i>{1} * DC<$((i % 7 + 1))>{2} / DB<$((i + 1)), 1>{3}; }"
+    done
+} > "$work_dir/dimension.cpp"
+
+TIMEFORMAT="%R"
+
+echo "Compiling $num_units derived units with $cxx"
+tag_time=$({ time $cxx -std=c++20 -I"$include_dir" -c "$work_dir/tag.cpp" -o "$work_dir/tag.o" ; } 2>&1)
+echo "CompoundUnit: ${tag_time}s"
+dimension_time=$({ time $cxx -std=c++20 -I"$include_dir" -c "$work_dir/dimension.cpp" \
+    -o "$work_dir/dimension.o" ; } 2>&1)
+echo "DimensionUnit: ${dimension_time}s"